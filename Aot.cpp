@@ -0,0 +1,195 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <vector>
+#include "Aot.h"
+
+using namespace std;
+
+
+void aotRuntime::clearScreen(aotState& state) {
+	state.machine.clearScreen();
+}
+
+
+void aotRuntime::drawSprite(aotState& state, unsigned char xCoord, unsigned char yCoord, int height, bool clip) {
+	if (clip) {
+		state.machine.drawSprite<true>(xCoord, yCoord, height);
+	}
+	else {
+		state.machine.drawSprite<false>(xCoord, yCoord, height);
+	}
+}
+
+
+unsigned char aotRuntime::randomByte(aotState& state) {
+	return state.machine.randomByte();
+}
+
+
+void aotRuntime::scrollDown(aotState& state, int lines) {
+	state.machine.scrollDown(lines);
+}
+
+
+void aotRuntime::scrollRight(aotState& state) {
+	state.machine.scrollRight();
+}
+
+
+void aotRuntime::scrollLeft(aotState& state) {
+	state.machine.scrollLeft();
+}
+
+
+void aotRuntime::setHires(aotState& state, bool enabled) {
+	state.machine.setHires(enabled);
+}
+
+
+void aotRuntime::saveFlags(aotState& state, int last) {
+	for (int j = 0; j <= last; j++) {
+		state.machine.rplFlags[j] = state.V[j];
+	}
+}
+
+
+void aotRuntime::loadFlags(aotState& state, int last) {
+	for (int j = 0; j <= last; j++) {
+		state.V[j] = state.machine.rplFlags[j];
+	}
+}
+
+
+bool aotRunner::attach(chip8& machine, const aotProgram* compiled) {
+	detach();
+
+	//The recompiler only handles the classic 4K machine
+	if (compiled == nullptr || compiled->quirks != machine.getQuirks() || machine.isXoChip()) {
+		return false;
+	}
+
+	//The blocks are only valid for the exact ROM image they were compiled from
+	if (compiled->romSize > 4096 - 512) {
+		return false;
+	}
+	vector<unsigned char> rom(compiled->romSize);
+	for (size_t i = 0; i < rom.size(); i++) {
+		rom[i] = machine.memory[512 + i];
+	}
+	if (hashRom(rom.data(), rom.size()) != compiled->romHash) {
+		return false;
+	}
+
+	for (int i = 0; i < compiled->blockCount; i++) {
+		blockAt[compiled->blocks[i].address] = &compiled->blocks[i];
+	}
+
+	for (int i = 0; i < compiled->codeRangeCount; i++) {
+		for (int address = compiled->code[i].start; address < compiled->code[i].end; address++) {
+			codeMap[address] = 1;
+		}
+	}
+
+	program = compiled;
+	return true;
+}
+
+
+void aotRunner::detach() {
+	program = nullptr;
+	codeModified = false;
+
+	for (int i = 0; i < 4096; i++) {
+		blockAt[i] = nullptr;
+		codeMap[i] = 0;
+	}
+}
+
+
+bool aotRunner::attached() const {
+	return program != nullptr;
+}
+
+
+void aotRunner::interpret(chip8& machine) {
+	//Find out which bytes the instruction is about to store to, decoding it the way emulateCycle() will
+	unsigned short opcode = machine.nextOpcode();
+	unsigned start = machine.I;
+	unsigned end = start;
+
+	if ((opcode & 0xF00F) == 0xF003) {
+		end = start + 3; //FX33
+	}
+	else if ((opcode & 0xF0FF) == 0xF055) {
+		end = start + ((opcode & 0x0F00) >> 8) + 1; //FX55
+	}
+
+	machine.emulateCycle();
+
+	for (unsigned address = start; address < end; address++) {
+		if (codeMap[address & 0xFFF]) {
+			codeModified = true;
+		}
+	}
+}
+
+
+void aotRunner::run(chip8& machine, int cycles) {
+	aotState state = { machine, machine.memory, machine.V, machine.I, machine.pc, machine.stack, machine.stack_pointer,
+		machine.delay_timer, machine.sound_timer, machine.key, codeMap, false };
+
+	while (cycles > 0) {
+		const aotBlock* block = (machine.pc < 4096 && !codeModified) ? blockAt[machine.pc] : nullptr;
+
+		//Fall back to the interpreter for undiscovered code, modified code, and blocks longer than the cycles left
+		if (block == nullptr || block->length > cycles) {
+			interpret(machine);
+			cycles--;
+			continue;
+		}
+
+		block->function(state);
+		cycles -= block->length;
+
+		if (state.codeModified) {
+			codeModified = true;
+		}
+	}
+}
+
+
+//Function-local so registrations from other translation units' static initializers always find it constructed
+static vector<const aotProgram*>& aotPrograms() {
+	static vector<const aotProgram*> programs;
+	return programs;
+}
+
+
+void registerAotProgram(const aotProgram* compiled) {
+	aotPrograms().push_back(compiled);
+}
+
+
+const aotProgram* findAotProgram(chip8& machine) {
+	for (const aotProgram* compiled : aotPrograms()) {
+		if (compiled->quirks != machine.getQuirks() || compiled->romSize > 4096 - 512 || machine.isXoChip()) {
+			continue;
+		}
+
+		vector<unsigned char> rom(compiled->romSize);
+		for (size_t i = 0; i < rom.size(); i++) {
+			rom[i] = machine.readMemory((unsigned short)(512 + i));
+		}
+
+		if (hashRom(rom.data(), rom.size()) == compiled->romHash) {
+			return compiled;
+		}
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,118 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include "Chip8.h"
+#include "RomAnalysis.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Runtime for ROMs compiled ahead of time by the recompiler (Recompiler.cpp).
+The recompiler turns every basic block of a ROM in to a C++ function that works directly on a chip8's registers and memory.
+aotRunner calls those functions in place of emulateCycle() and hands control back to the interpreter whenever the program
+counter lands on an address the recompiler never discovered, or once the ROM writes over its own code.
+********************************************************************************************************************************/
+
+//The machine state seen by a recompiled block. The references point straight in to the chip8 being run.
+struct aotState {
+	chip8& machine;
+	const cowPages<unsigned char, MEMORY_PAGE_SIZE>& memory; //Read only; writes go through aotRuntime::store()
+	unsigned char* V;
+	unsigned short& I;
+	unsigned short& pc;
+	unsigned short* stack;
+	unsigned short& stack_pointer;
+	unsigned char& delay_timer;
+	unsigned char& sound_timer;
+	int* key;
+
+	const unsigned char* codeMap; //1 for every memory byte that was compiled as code
+	bool codeModified; //Set once the ROM writes to one of its own instructions
+};
+
+typedef void (*aotBlockFunction)(aotState&);
+
+//One recompiled basic block
+struct aotBlock {
+	unsigned short address; //Address of the first instruction
+	unsigned short length; //Number of instructions the block executes
+	aotBlockFunction function;
+};
+
+//A run of memory [start, end) that the recompiler treated as code
+struct aotCodeRange {
+	unsigned short start;
+	unsigned short end;
+};
+
+//Everything the recompiler emits for one ROM
+struct aotProgram {
+	const char* name;
+	unsigned long long romHash; //hashRom() of the ROM the blocks were compiled from
+	unsigned short romSize;
+	unsigned quirks; //Quirk set the blocks were compiled for
+	const aotBlock* blocks;
+	int blockCount;
+	const aotCodeRange* code;
+	int codeRangeCount;
+};
+
+//Operations recompiled blocks call back in to the interpreter for
+class aotRuntime {
+public:
+	static void clearScreen(aotState& state); //00E0
+	static void drawSprite(aotState& state, unsigned char xCoord, unsigned char yCoord, int height, bool clip); //DXYN
+	static unsigned char randomByte(aotState& state); //CXKK
+	static void scrollDown(aotState& state, int lines); //00CN
+	static void scrollRight(aotState& state); //00FB
+	static void scrollLeft(aotState& state); //00FC
+	static void setHires(aotState& state, bool enabled); //00FE / 00FF
+	static void saveFlags(aotState& state, int last); //FX75
+	static void loadFlags(aotState& state, int last); //FX85
+
+	//FX33/FX55: Every memory write goes through here so self-modifying code is noticed
+	static void store(aotState& state, unsigned short address, unsigned char value) {
+		state.machine.storeMemory(address, value);
+		if (state.codeMap[address & 0xFFF]) {
+			state.codeModified = true;
+		}
+	}
+};
+
+//Runs a chip8 with the recompiled blocks of the ROM loaded in it
+class aotRunner {
+	const aotProgram* program = nullptr;
+
+	const aotBlock* blockAt[4096] = { nullptr }; //Recompiled block starting at each address
+	unsigned char codeMap[4096] = { 0 };
+	bool codeModified = false;
+
+	void interpret(chip8& machine); //Run one instruction through emulateCycle(), watching for writes to code
+
+public:
+
+	bool attach(chip8& machine, const aotProgram* compiled); //Use compiled for machine if it matches the loaded ROM and quirks
+
+	void detach(); //Go back to plain interpretation
+
+	bool attached() const; //True while recompiled blocks are in use
+
+	void run(chip8& machine, int cycles); //Execute exactly cycles instructions
+};
+
+//Recompiled translation units register their program at start-up
+void registerAotProgram(const aotProgram* compiled);
+
+const aotProgram* findAotProgram(chip8& machine); //The registered program matching the ROM loaded in machine, or nullptr
+
+struct aotRegistration {
+	aotRegistration(const aotProgram* compiled) {
+		registerAotProgram(compiled);
+	}
+};
@@ -0,0 +1,210 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "Audio.h"
+
+using namespace std;
+
+const double BUZZER_FREQUENCY = 440.0; //Classic CHIP-8 buzzer tone in Hz
+const short BUZZER_VOLUME = 8000; //Peak amplitude out of 32767
+
+
+audioRing::audioRing(size_t capacity) {
+	size_t size = 1;
+	while (size < capacity) {
+		size *= 2;
+	}
+
+	buffer.assign(size, 0);
+	mask = size - 1;
+}
+
+
+size_t audioRing::push(const short* samples, size_t count) {
+	size_t written = head.load(memory_order_relaxed);
+	size_t read = tail.load(memory_order_acquire);
+	count = min(count, buffer.size() - (written - read));
+
+	for (size_t i = 0; i < count; i++) {
+		buffer[(written + i) & mask] = samples[i];
+	}
+
+	//Publish the samples only after they are in the buffer
+	head.store(written + count, memory_order_release);
+	return count;
+}
+
+
+size_t audioRing::pop(short* samples, size_t count) {
+	size_t read = tail.load(memory_order_relaxed);
+	size_t written = head.load(memory_order_acquire);
+	count = min(count, written - read);
+
+	for (size_t i = 0; i < count; i++) {
+		samples[i] = buffer[(read + i) & mask];
+	}
+
+	//Hand the space back only after the samples are copied out
+	tail.store(read + count, memory_order_release);
+	return count;
+}
+
+
+size_t audioRing::available() const {
+	return head.load(memory_order_acquire) - tail.load(memory_order_acquire);
+}
+
+
+//Little-endian integers for the WAV header
+static void writeLittleEndian(ofstream& file, unsigned value, int bytes) {
+	for (int i = 0; i < bytes; i++) {
+		file.put((char)((value >> (i * 8)) & 0xFF));
+	}
+}
+
+
+wavSink::wavSink(const string& path, int sampleRate) {
+	file.open(path, ios::out | ios::binary | ios::trunc);
+	if (file) {
+		writeHeader(sampleRate);
+	}
+}
+
+
+void wavSink::writeHeader(int sampleRate) {
+	file.write("RIFF", 4);
+	writeLittleEndian(file, 0, 4); //RIFF size, filled in by the destructor
+	file.write("WAVE", 4);
+
+	file.write("fmt ", 4);
+	writeLittleEndian(file, 16, 4);
+	writeLittleEndian(file, 1, 2); //PCM
+	writeLittleEndian(file, 1, 2); //Mono
+	writeLittleEndian(file, sampleRate, 4);
+	writeLittleEndian(file, sampleRate * 2, 4); //Bytes per second
+	writeLittleEndian(file, 2, 2); //Bytes per sample
+	writeLittleEndian(file, 16, 2); //Bits per sample
+
+	file.write("data", 4);
+	writeLittleEndian(file, 0, 4); //Data size, filled in by the destructor
+}
+
+
+wavSink::~wavSink() {
+	if (!file) {
+		return;
+	}
+
+	file.seekp(4);
+	writeLittleEndian(file, (unsigned)(36 + dataBytes), 4);
+	file.seekp(40);
+	writeLittleEndian(file, (unsigned)dataBytes, 4);
+}
+
+
+bool wavSink::isOpen() const {
+	return file.is_open() && file.good();
+}
+
+
+void wavSink::write(const short* samples, size_t count) {
+	bytes.resize(count * 2);
+	for (size_t i = 0; i < count; i++) {
+		bytes[i * 2] = (char)(samples[i] & 0xFF);
+		bytes[i * 2 + 1] = (char)((samples[i] >> 8) & 0xFF);
+	}
+
+	file.write(bytes.data(), bytes.size());
+	dataBytes += bytes.size();
+}
+
+
+audioPipeline::audioPipeline(unique_ptr<audioSink> output, int rate)
+	: sink(move(output)), sampleRate(rate), ring((size_t)rate / 4) //A quarter of a second of slack for the consumer
+{
+	//A discarding sink never gets any samples, so it needs no thread either
+	if (!sink->discards()) {
+		running = true;
+		consumer = thread(&audioPipeline::drain, this);
+	}
+}
+
+
+audioPipeline::~audioPipeline() {
+	if (consumer.joinable()) {
+		running = false;
+		consumer.join();
+	}
+}
+
+
+void audioPipeline::drain() {
+	short samples[1024];
+
+	while (true) {
+		//Check running before popping, so the samples pushed before the pipeline was stopped are still written
+		bool stopping = !running.load();
+		size_t count = ring.pop(samples, 1024);
+
+		if (count > 0) {
+			sink->write(samples, count);
+		}
+		else if (stopping) {
+			return;
+		}
+		else {
+			this_thread::sleep_for(chrono::milliseconds(2));
+		}
+	}
+}
+
+
+void audioPipeline::frame(const chip8& machine) {
+	if (sink->discards()) {
+		return;
+	}
+
+	samplesOwed += sampleRate / 60.0;
+	int count = (int)samplesOwed;
+	samplesOwed -= count;
+	chunk.assign(count, 0);
+
+	if (machine.getSoundTimer() > 0) {
+		if (machine.isXoChip()) {
+			//Play the 128 bit pattern, one bit per step, at the rate set by the pitch register
+			const unsigned char* pattern = machine.getAudioPattern();
+			double step = 4000.0 * pow(2.0, (machine.getAudioPitch() - 64) / 48.0) / sampleRate;
+
+			for (int i = 0; i < count; i++) {
+				int bit = (int)phase;
+				chunk[i] = ((pattern[bit >> 3] >> (7 - (bit & 7))) & 1) ? BUZZER_VOLUME : -BUZZER_VOLUME;
+				phase = fmod(phase + step, 128.0);
+			}
+		}
+		else {
+			double step = BUZZER_FREQUENCY / sampleRate;
+
+			for (int i = 0; i < count; i++) {
+				chunk[i] = phase < 0.5 ? BUZZER_VOLUME : -BUZZER_VOLUME;
+				phase = fmod(phase + step, 1.0);
+			}
+		}
+	}
+	else {
+		phase = 0; //Every tone starts at the beginning of the wave or pattern
+	}
+
+	droppedSamples += count - ring.push(chunk.data(), count);
+}
+
+
+unsigned long long audioPipeline::dropped() const {
+	return droppedSamples;
+}
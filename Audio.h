@@ -0,0 +1,105 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Audio pipeline. Once per 60 Hz frame the emulation thread synthesizes the buzzer for that frame (a square wave, or the XO-CHIP
+pattern in XO-CHIP mode) and pushes the samples in to a single-producer single-consumer ring. A consumer thread drains the
+ring in to an audioSink. Pushing never waits: if the sink falls behind, the samples that do not fit are dropped and counted.
+With a sink that discards everything (batch and headless runs) nothing is synthesized and no thread is started.
+********************************************************************************************************************************/
+
+//Lock-free ring of 16-bit samples between exactly one producer thread and one consumer thread
+class audioRing {
+	vector<short> buffer;
+	size_t mask; //buffer.size() - 1, the size is a power of two
+
+	alignas(64) atomic<size_t> head{ 0 }; //Total samples pushed. Only the producer writes it.
+	alignas(64) atomic<size_t> tail{ 0 }; //Total samples popped. Only the consumer writes it.
+
+public:
+	explicit audioRing(size_t capacity); //capacity is rounded up to a power of two
+
+	size_t push(const short* samples, size_t count); //Producer: copy in as many samples as fit, return how many did
+
+	size_t pop(short* samples, size_t count); //Consumer: copy out up to count samples, return how many
+
+	size_t available() const; //Samples waiting to be popped
+};
+
+//Where the synthesized samples end up. write() is only ever called from the consumer thread.
+class audioSink {
+public:
+	virtual ~audioSink() {}
+
+	virtual void write(const short* samples, size_t count) = 0;
+
+	virtual bool discards() const { return false; } //True if samples are thrown away, so there is no point making them
+};
+
+//Throws every sample away
+class nullSink : public audioSink {
+public:
+	void write(const short*, size_t) override {}
+
+	bool discards() const override { return true; }
+};
+
+//Streams 16-bit mono PCM to a WAV file. The sizes in the header are filled in when the sink is destroyed.
+class wavSink : public audioSink {
+	ofstream file;
+	unsigned long long dataBytes = 0;
+	vector<char> bytes; //Samples converted to little-endian for one write()
+
+	void writeHeader(int sampleRate);
+
+public:
+	wavSink(const string& path, int sampleRate);
+
+	~wavSink();
+
+	bool isOpen() const; //False if the file could not be created
+
+	void write(const short* samples, size_t count) override;
+};
+
+//Synthesizes a chip8's buzzer and feeds it through an audioRing to a sink
+class audioPipeline {
+	unique_ptr<audioSink> sink;
+	int sampleRate;
+
+	audioRing ring;
+	thread consumer;
+	atomic<bool> running{ false };
+
+	vector<short> chunk; //One frame of samples
+	double samplesOwed = 0; //Fraction of a sample carried to the next frame, so frames average exactly sampleRate / 60
+	double phase = 0; //Position in the square wave (0-1) or the XO-CHIP pattern (0-128)
+	unsigned long long droppedSamples = 0;
+
+	void drain(); //Consumer thread
+
+public:
+	audioPipeline(unique_ptr<audioSink> output, int rate = 44100);
+
+	~audioPipeline(); //Drains the ring in to the sink and stops the consumer thread
+
+	void frame(const chip8& machine); //Emulation thread: synthesize one 60 Hz frame of the buzzer. Never blocks.
+
+	unsigned long long dropped() const; //Samples lost because the ring was full
+};
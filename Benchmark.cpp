@@ -0,0 +1,117 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Benchmark: runs ROMs without a window on every interpreter core, plus their recompiled blocks when those are linked in, and
+prints how many million CHIP-8 instructions per second each one manages.
+
+Usage: Benchmark [frames] [rom...]
+
+Build it with CHIP8_HEADLESS defined so it does not need OpenGL. Each frame is 10 cycles followed by decreaseTimers(),
+the same as runGame(). No keys are pressed.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "Chip8.h"
+#include "Aot.h"
+
+using namespace std;
+
+const char* defaultRoms[] = { "15PUZZLE", "BLINKY", "BRIX", "CONNECT4", "GUESS", "HIDDEN", "INVADERS", "KALEID", "MAZE", "MERLIN",
+	"MISSILE", "PONG", "PONG2", "PUZZLE", "TANK", "TETRIS", "TICTAC", "UFO", "VERS", "WIPEOFF" };
+
+const char* coreNames[] = { "switch", "predecoded", "threaded", "recompiled" };
+
+chip8 machine;
+aotRunner recompiled;
+
+//Seconds it takes to run frames frames of rom on core (3 = recompiled blocks). Negative if the core is not available.
+double timeRom(const string& rom, int core, int frames) {
+	machine.initialize();
+	machine.setQuirks(quirksForRom(rom));
+	machine.setCore(core == 3 ? CORE_SWITCH : (interpreterCore)core);
+	machine.loadGame(rom);
+
+	for (int i = 0; i < 16; i++) {
+		machine.key[i] = 0;
+	}
+
+	if (core == 3 && !recompiled.attach(machine, findAotProgram(machine))) {
+		return -1;
+	}
+
+	auto start = chrono::steady_clock::now();
+
+	for (int frame = 0; frame < frames; frame++) {
+		if (core == 3) {
+			recompiled.run(machine, 10);
+		}
+		else {
+			machine.runCycles(10);
+		}
+		machine.decreaseTimers();
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	recompiled.detach();
+	return elapsed.count();
+}
+
+int main(int argc, char** argv) {
+	int frames = (argc > 1) ? atoi(argv[1]) : 100000;
+	vector<string> roms(argv + min(argc, 2), argv + argc);
+
+	if (roms.empty()) {
+		roms.assign(begin(defaultRoms), end(defaultRoms));
+	}
+
+	cout << left << setw(12) << "ROM";
+	for (const char* name : coreNames) {
+		cout << right << setw(12) << name;
+	}
+	cout << "   (million instructions per second)" << endl;
+
+	vector<double> totals(4, 0);
+
+	for (const string& rom : roms) {
+		cout << left << setw(12) << rom.substr(rom.find_last_of("/\\") + 1);
+
+		for (int core = 0; core < 4; core++) {
+			double seconds = timeRom(rom, core, frames);
+
+			if (seconds < 0) {
+				cout << right << setw(12) << "-";
+				totals[core] = -1;
+			}
+			else {
+				cout << right << setw(12) << fixed << setprecision(1) << frames * 10 / seconds / 1e6;
+				if (totals[core] >= 0) {
+					totals[core] += seconds;
+				}
+			}
+		}
+		cout << endl;
+	}
+
+	cout << left << setw(12) << "all";
+	for (int core = 0; core < 4; core++) {
+		if (totals[core] > 0) {
+			cout << right << setw(12) << fixed << setprecision(1) << roms.size() * frames * 10 / totals[core] / 1e6;
+		}
+		else {
+			cout << right << setw(12) << "-";
+		}
+	}
+	cout << endl;
+
+	return 0;
+}
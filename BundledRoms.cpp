@@ -0,0 +1,665 @@
+//Generated by RomPack from 15PUZZLE BLINKY BRIX CONNECT4 GUESS HIDDEN INVADERS KALEID MAZE MERLIN MISSILE PONG PONG2 PUZZLE TANK TETRIS TICTAC UFO VERS WIPEOFF. Do not edit.
+
+#include "RomLibrary.h"
+
+static constexpr unsigned char rom_15PUZZLE[] = {
+	0x00, 0xE0, 0x6C, 0x00, 0x4C, 0x00, 0x6E, 0x0F, 0xA2, 0x03, 0x60, 0x20, 0xF0, 0x55, 0x00, 0xE0,
+	0x22, 0xBE, 0x22, 0x76, 0x22, 0x8E, 0x22, 0x5E, 0x22, 0x46, 0x12, 0x10, 0x61, 0x00, 0x62, 0x17,
+	0x63, 0x04, 0x41, 0x10, 0x00, 0xEE, 0xA2, 0xE8, 0xF1, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x12, 0x34,
+	0xF0, 0x29, 0xD2, 0x35, 0x71, 0x01, 0x72, 0x05, 0x64, 0x03, 0x84, 0x12, 0x34, 0x00, 0x12, 0x22,
+	0x62, 0x17, 0x73, 0x06, 0x12, 0x22, 0x64, 0x03, 0x84, 0xE2, 0x65, 0x03, 0x85, 0xD2, 0x94, 0x50,
+	0x00, 0xEE, 0x44, 0x03, 0x00, 0xEE, 0x64, 0x01, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x46, 0x64, 0x03,
+	0x84, 0xE2, 0x65, 0x03, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x00, 0x00, 0xEE, 0x64, 0xFF,
+	0x84, 0xE4, 0x22, 0xA6, 0x12, 0x5E, 0x64, 0x0C, 0x84, 0xE2, 0x65, 0x0C, 0x85, 0xD2, 0x94, 0x50,
+	0x00, 0xEE, 0x44, 0x00, 0x00, 0xEE, 0x64, 0xFC, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x76, 0x64, 0x0C,
+	0x84, 0xE2, 0x65, 0x0C, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x0C, 0x00, 0xEE, 0x64, 0x04,
+	0x84, 0xE4, 0x22, 0xA6, 0x12, 0x8E, 0xA2, 0xE8, 0xF4, 0x1E, 0xF0, 0x65, 0xA2, 0xE8, 0xFE, 0x1E,
+	0xF0, 0x55, 0x60, 0x00, 0xA2, 0xE8, 0xF4, 0x1E, 0xF0, 0x55, 0x8E, 0x40, 0x00, 0xEE, 0x3C, 0x00,
+	0x12, 0xD2, 0x22, 0x1C, 0x22, 0xD8, 0x22, 0x1C, 0xA2, 0xF8, 0xFD, 0x1E, 0xF0, 0x65, 0x8D, 0x00,
+	0x00, 0xEE, 0x7C, 0xFF, 0xCD, 0x0F, 0x00, 0xEE, 0x7D, 0x01, 0x60, 0x0F, 0x8D, 0x02, 0xED, 0x9E,
+	0x12, 0xD8, 0xED, 0xA1, 0x12, 0xE2, 0x00, 0xEE, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08,
+	0x09, 0x0A, 0x0C, 0x0E, 0x03, 0x07, 0x0B, 0x0F, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x76, 0x64, 0x0C,
+	0x84, 0xE2, 0x65, 0x0C, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x0C, 0x00, 0xEE, 0x64, 0x04,
+	0x84, 0xE4, 0x22, 0xA6, 0x12, 0x8E, 0xA2, 0xE8, 0xF4, 0x1E, 0xF0, 0x65, 0xA2, 0xE8, 0xFE, 0x1E,
+	0xF0, 0x55, 0x60, 0x00, 0xA2, 0xE8, 0xF4, 0x1E, 0xF0, 0x55, 0x8E, 0x40, 0x00, 0xEE, 0x3C, 0x00,
+	0x12, 0xD2, 0x22, 0x1C, 0x22, 0xD8, 0x22, 0x1C, 0xA2, 0xF8, 0xFD, 0x1E, 0xF0, 0x65, 0x8D, 0x00,
+	0x00, 0xEE, 0x7C, 0xFF, 0xCD, 0x0F, 0x00, 0xEE, 0x7D, 0x01, 0x60, 0x0F, 0x8D, 0x02, 0xED, 0x9E,
+	0x12, 0xD8, 0xED, 0xA1, 0x12, 0xE2, 0x00, 0xEE, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08
+};
+
+static constexpr unsigned char rom_BLINKY[] = {
+	0x12, 0x1A, 0x32, 0x2E, 0x30, 0x30, 0x20, 0x43, 0x2E, 0x20, 0x45, 0x67, 0x65, 0x62, 0x65, 0x72,
+	0x67, 0x20, 0x31, 0x38, 0x2F, 0x38, 0x2D, 0x27, 0x39, 0x31, 0x80, 0x03, 0x81, 0x13, 0xA8, 0xC8,
+	0xF1, 0x55, 0x60, 0x05, 0xA8, 0xCC, 0xF0, 0x55, 0x87, 0x73, 0x86, 0x63, 0x27, 0x72, 0x00, 0xE0,
+	0x27, 0x94, 0x6E, 0x40, 0x87, 0xE2, 0x6E, 0x27, 0x87, 0xE1, 0x68, 0x1A, 0x69, 0x0C, 0x6A, 0x38,
+	0x6B, 0x00, 0x6C, 0x02, 0x6D, 0x1A, 0x27, 0x50, 0xA8, 0xED, 0xDA, 0xB4, 0xDC, 0xD4, 0x23, 0xD0,
+	0x3E, 0x00, 0x12, 0x7C, 0xA8, 0xCC, 0xF0, 0x65, 0x85, 0x00, 0xC4, 0xFF, 0x84, 0x52, 0x24, 0xF6,
+	0xC4, 0xFF, 0x84, 0x52, 0x26, 0x1E, 0x60, 0x01, 0xE0, 0xA1, 0x27, 0xD6, 0x36, 0xF7, 0x12, 0x4E,
+	0x8E, 0x60, 0x28, 0x7A, 0x6E, 0x64, 0x28, 0x7A, 0x27, 0xD6, 0x12, 0x2A, 0xF0, 0x07, 0x40, 0x00,
+	0x13, 0x10, 0x80, 0x80, 0x80, 0x06, 0x81, 0xA0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0x9A,
+	0x40, 0x01, 0x12, 0x9A, 0x40, 0xFF, 0x12, 0x9A, 0x12, 0xC8, 0x80, 0x90, 0x80, 0x06, 0x81, 0xB0,
+	0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0xB2, 0x40, 0x01, 0x12, 0xB2, 0x40, 0xFF, 0x12, 0xB2,
+	0x12, 0xC8, 0xA8, 0xED, 0xDA, 0xB4, 0x6A, 0x38, 0x6B, 0x00, 0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2,
+	0x6E, 0x04, 0x87, 0xE1, 0x6E, 0x32, 0x28, 0x7A, 0x80, 0x80, 0x80, 0x06, 0x81, 0xC0, 0x81, 0x06,
+	0x80, 0x15, 0x40, 0x00, 0x12, 0xE0, 0x40, 0x01, 0x12, 0xE0, 0x40, 0xFF, 0x12, 0xE0, 0x12, 0x54,
+	0x80, 0x90, 0x80, 0x06, 0x81, 0xD0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0xF8, 0x40, 0x01,
+	0x12, 0xF8, 0x40, 0xFF, 0x12, 0xF8, 0x12, 0x54, 0xA8, 0xED, 0xDC, 0xD4, 0x6C, 0x02, 0x6D, 0x1A,
+	0xDC, 0xD4, 0x6E, 0xCF, 0x87, 0xE2, 0x6E, 0x20, 0x87, 0xE1, 0x6E, 0x19, 0x28, 0x7A, 0x12, 0x54,
+	0x60, 0x3F, 0x28, 0xA8, 0x27, 0x50, 0xA8, 0xED, 0xDA, 0xB4, 0xDC, 0xD4, 0x6E, 0x40, 0x87, 0xE3,
+	0x80, 0x70, 0x80, 0xE2, 0x30, 0x00, 0x12, 0x32, 0x8E, 0x60, 0x28, 0x7A, 0x28, 0x8A, 0x00, 0xE0,
+	0x66, 0x11, 0x67, 0x0A, 0xA8, 0xCA, 0x27, 0xE6, 0x66, 0x11, 0x67, 0x10, 0xA8, 0xC8, 0x27, 0xE6,
+	0x64, 0x00, 0x65, 0x08, 0x66, 0x00, 0x67, 0x0F, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+	0x60, 0x03, 0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+	0x74, 0x02, 0x75, 0x02, 0x34, 0x30, 0x13, 0x48, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+	0x60, 0x03, 0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+	0x76, 0x02, 0x36, 0x16, 0x13, 0x68, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x60, 0x03,
+	0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x74, 0xFE,
+	0x75, 0xFE, 0x34, 0x00, 0x13, 0x86, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x60, 0x03,
+	0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x76, 0xFE,
+	0x36, 0x00, 0x13, 0xA6, 0x13, 0x48, 0xAB, 0x22, 0xD5, 0x69, 0xAB, 0x2B, 0xD5, 0x69, 0x12, 0x1A,
+	0x83, 0x70, 0x6E, 0x03, 0x83, 0xE2, 0x84, 0x80, 0x85, 0x90, 0x6E, 0x06, 0xEE, 0xA1, 0x14, 0x32,
+	0x6E, 0x03, 0xEE, 0xA1, 0x14, 0x4A, 0x6E, 0x08, 0xEE, 0xA1, 0x14, 0x62, 0x6E, 0x07, 0xEE, 0xA1,
+	0x14, 0x7A, 0x43, 0x03, 0x75, 0x02, 0x43, 0x00, 0x75, 0xFE, 0x43, 0x02, 0x74, 0x02, 0x43, 0x01,
+	0x74, 0xFE, 0x80, 0x40, 0x81, 0x50, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2, 0x30, 0x00,
+	0x14, 0x92, 0x6E, 0x07, 0x80, 0x20, 0x82, 0xE2, 0x42, 0x05, 0x14, 0x9A, 0x42, 0x06, 0x14, 0xB2,
+	0x42, 0x07, 0x14, 0xEC, 0x27, 0x50, 0x6E, 0xFC, 0x87, 0xE2, 0x87, 0x31, 0x88, 0x40, 0x89, 0x50,
+	0x17, 0x50, 0x80, 0x40, 0x81, 0x50, 0x71, 0x02, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+	0x30, 0x00, 0x13, 0xF2, 0x63, 0x03, 0x75, 0x02, 0x14, 0x0E, 0x80, 0x40, 0x81, 0x50, 0x71, 0xFE,
+	0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2, 0x30, 0x00, 0x13, 0xF2, 0x63, 0x00, 0x75, 0xFE,
+	0x14, 0x0E, 0x80, 0x40, 0x81, 0x50, 0x70, 0x02, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+	0x30, 0x00, 0x13, 0xF2, 0x63, 0x02, 0x74, 0x02, 0x14, 0x0E, 0x80, 0x40, 0x81, 0x50, 0x70, 0xFE,
+	0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2, 0x30, 0x00, 0x13, 0xF2, 0x63, 0x01, 0x74, 0xFE,
+	0x14, 0x0E, 0x27, 0x50, 0xD8, 0x94, 0x8E, 0xF0, 0x00, 0xEE, 0x6E, 0xF0, 0x80, 0xE2, 0x80, 0x31,
+	0xF0, 0x55, 0xA8, 0xF1, 0xD4, 0x54, 0x76, 0x01, 0x61, 0x05, 0xF0, 0x07, 0x40, 0x00, 0xF1, 0x18,
+	0x14, 0x24, 0x6E, 0xF0, 0x80, 0xE2, 0x80, 0x31, 0xF0, 0x55, 0xA8, 0xF5, 0xD4, 0x54, 0x76, 0x04,
+	0x80, 0xA0, 0x81, 0xB0, 0x27, 0xBA, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00, 0x14, 0xD2, 0x6E, 0x0C,
+	0x87, 0xE3, 0x80, 0xC0, 0x81, 0xD0, 0x27, 0xBA, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00, 0x14, 0xE4,
+	0x6E, 0x30, 0x87, 0xE3, 0x60, 0xFF, 0xF0, 0x18, 0xF0, 0x15, 0x14, 0x24, 0x43, 0x01, 0x64, 0x3A,
+	0x43, 0x02, 0x64, 0x00, 0x14, 0x24, 0x82, 0x70, 0x83, 0x70, 0x6E, 0x0C, 0x82, 0xE2, 0x80, 0xA0,
+	0x81, 0xB0, 0x27, 0xBA, 0xA8, 0xED, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00, 0x15, 0x24, 0xDA, 0xB4,
+	0x42, 0x0C, 0x7B, 0x02, 0x42, 0x00, 0x7B, 0xFE, 0x42, 0x08, 0x7A, 0x02, 0x42, 0x04, 0x7A, 0xFE,
+	0xDA, 0xB4, 0x00, 0xEE, 0x6E, 0x80, 0xF1, 0x07, 0x31, 0x00, 0x15, 0xD4, 0x34, 0x00, 0x15, 0xD4,
+	0x81, 0x00, 0x83, 0x0E, 0x3F, 0x00, 0x15, 0x56, 0x83, 0x90, 0x83, 0xB5, 0x4F, 0x00, 0x15, 0x8C,
+	0x33, 0x00, 0x15, 0x74, 0x87, 0xE3, 0x83, 0x80, 0x83, 0xA5, 0x4F, 0x00, 0x15, 0xBC, 0x33, 0x00,
+	0x15, 0xA4, 0x87, 0xE3, 0x15, 0xD4, 0x83, 0x80, 0x83, 0xA5, 0x4F, 0x00, 0x15, 0xBC, 0x33, 0x00,
+	0x15, 0xA4, 0x87, 0xE3, 0x83, 0x90, 0x83, 0xB5, 0x4F, 0x00, 0x15, 0x8C, 0x33, 0x00, 0x15, 0x74,
+	0x87, 0xE3, 0x15, 0xD4, 0x63, 0x40, 0x81, 0x32, 0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7B, 0x02,
+	0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x62, 0x0C, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x10, 0x81, 0x32,
+	0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7B, 0xFE, 0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x62, 0x00,
+	0x87, 0x21, 0x00, 0xEE, 0x63, 0x20, 0x81, 0x32, 0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7A, 0x02,
+	0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x62, 0x08, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x80, 0x81, 0x32,
+	0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7A, 0xFE, 0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x62, 0x04,
+	0x87, 0x21, 0x00, 0xEE, 0xC1, 0xF0, 0x80, 0x12, 0x30, 0x00, 0x15, 0xE4, 0x6E, 0x0C, 0x87, 0xE3,
+	0x82, 0xE3, 0x15, 0x0E, 0xDA, 0xB4, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xF2, 0x62, 0x04, 0x7A, 0xFE,
+	0x16, 0x14, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xFE, 0x62, 0x0C, 0x7B, 0x02, 0x16, 0x14, 0x80, 0x0E,
+	0x4F, 0x00, 0x16, 0x0A, 0x62, 0x08, 0x7A, 0x02, 0x16, 0x14, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xDC,
+	0x62, 0x00, 0x7B, 0xFE, 0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x87, 0x21, 0x00, 0xEE, 0x82, 0x70,
+	0x83, 0x70, 0x6E, 0x30, 0x82, 0xE2, 0x80, 0xC0, 0x81, 0xD0, 0x27, 0xBA, 0xA8, 0xED, 0x6E, 0xF0,
+	0x80, 0xE2, 0x30, 0x00, 0x16, 0x4C, 0xDC, 0xD4, 0x42, 0x30, 0x7D, 0x02, 0x42, 0x00, 0x7D, 0xFE,
+	0x42, 0x20, 0x7C, 0x02, 0x42, 0x10, 0x7C, 0xFE, 0xDC, 0xD4, 0x00, 0xEE, 0x6E, 0x80, 0xF1, 0x07,
+	0x31, 0x00, 0x17, 0x04, 0x34, 0x00, 0x17, 0x04, 0x81, 0x00, 0x83, 0x0E, 0x4F, 0x00, 0x16, 0x7E,
+	0x83, 0x90, 0x83, 0xD5, 0x4F, 0x00, 0x16, 0xB6, 0x33, 0x00, 0x16, 0x9C, 0x87, 0xE3, 0x83, 0x80,
+	0x83, 0xC5, 0x4F, 0x00, 0x16, 0xEA, 0x33, 0x00, 0x16, 0xD0, 0x87, 0xE3, 0x17, 0x04, 0x83, 0x80,
+	0x83, 0xC5, 0x4F, 0x00, 0x16, 0xEA, 0x33, 0x00, 0x16, 0xD0, 0x87, 0xE3, 0x83, 0x90, 0x83, 0xD5,
+	0x4F, 0x00, 0x16, 0xB6, 0x33, 0x00, 0x16, 0x9C, 0x87, 0xE3, 0x17, 0x04, 0x63, 0x40, 0x81, 0x32,
+	0x41, 0x00, 0x17, 0x04, 0xDC, 0xD4, 0x7D, 0x02, 0xDC, 0xD4, 0x87, 0xE3, 0x6E, 0xCF, 0x87, 0xE2,
+	0x62, 0x30, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x10, 0x81, 0x32, 0x41, 0x00, 0x17, 0x04, 0xDC, 0xD4,
+	0x7D, 0xFE, 0xDC, 0xD4, 0x87, 0xE3, 0x6E, 0xCF, 0x87, 0xE2, 0x62, 0x00, 0x87, 0x21, 0x00, 0xEE,
+	0x63, 0x20, 0x81, 0x32, 0x41, 0x00, 0x17, 0x04, 0xDC, 0xD4, 0x7C, 0x02, 0xDC, 0xD4, 0x87, 0xE3,
+	0x6E, 0xCF, 0x87, 0xE2, 0x62, 0x20, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x80, 0x81, 0x32, 0x41, 0x00,
+	0x17, 0x04, 0xDC, 0xD4, 0x7C, 0xFE, 0xDC, 0xD4, 0x87, 0xE3, 0x6E, 0xCF, 0x87, 0xE2, 0x62, 0x10,
+	0x87, 0x21, 0x00, 0xEE, 0xC1, 0xF0, 0x80, 0x12, 0x30, 0x00, 0x17, 0x16, 0x87, 0xE3, 0x6E, 0x30,
+	0x87, 0xE3, 0x82, 0xE3, 0x16, 0x36, 0xDC, 0xD4, 0x80, 0x0E, 0x4F, 0x00, 0x17, 0x24, 0x62, 0x90,
+	0x7C, 0xFE, 0x17, 0x46, 0x80, 0x0E, 0x4F, 0x00, 0x17, 0x30, 0x62, 0x30, 0x7D, 0x02, 0x17, 0x46,
+	0x80, 0x0E, 0x4F, 0x00, 0x17, 0x3C, 0x62, 0xA0, 0x7C, 0x02, 0x17, 0x46, 0x80, 0x0E, 0x4F, 0x00,
+	0x17, 0x0C, 0x62, 0x00, 0x7D, 0xFE, 0xDC, 0xD4, 0x6E, 0x4F, 0x87, 0xE2, 0x87, 0x21, 0x00, 0xEE,
+	0x80, 0x70, 0x6E, 0x03, 0x80, 0xE2, 0x80, 0x0E, 0x81, 0x80, 0x81, 0x94, 0x6E, 0x02, 0x81, 0xE2,
+	0x41, 0x00, 0x70, 0x01, 0x80, 0x0E, 0x80, 0x0E, 0xA8, 0xCD, 0xF0, 0x1E, 0xD8, 0x94, 0x8E, 0xF0,
+	0x00, 0xEE, 0x6E, 0x00, 0xA9, 0x19, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xF3, 0x65,
+	0xAB, 0x34, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xF3, 0x55, 0x7E, 0x01, 0x3E, 0x80,
+	0x17, 0x74, 0x00, 0xEE, 0x82, 0x23, 0x83, 0x33, 0x6E, 0x0F, 0x80, 0x20, 0x81, 0x30, 0x27, 0xBE,
+	0x80, 0xE2, 0x80, 0x0E, 0xA8, 0xF9, 0xF0, 0x1E, 0xD2, 0x32, 0x72, 0x02, 0x32, 0x40, 0x17, 0x9A,
+	0x82, 0x23, 0x73, 0x02, 0x43, 0x20, 0x00, 0xEE, 0x17, 0x9A, 0x70, 0x02, 0x71, 0x02, 0x80, 0x06,
+	0x81, 0x06, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0xAB, 0x34, 0xF1, 0x1E, 0xF1, 0x1E,
+	0xF0, 0x1E, 0xF0, 0x65, 0x00, 0xEE, 0xA8, 0xCC, 0xF0, 0x65, 0x80, 0x06, 0xF0, 0x55, 0x60, 0x01,
+	0xE0, 0xA1, 0x17, 0xE0, 0x00, 0xEE, 0xF1, 0x65, 0x6E, 0x01, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10,
+	0x65, 0x10, 0x83, 0x55, 0x4F, 0x00, 0x82, 0xE5, 0x4F, 0x00, 0x18, 0x0C, 0x65, 0x27, 0x82, 0x55,
+	0x4F, 0x00, 0x18, 0x0C, 0x80, 0x20, 0x81, 0x30, 0x84, 0xE4, 0x17, 0xF0, 0xF4, 0x29, 0xD6, 0x75,
+	0x76, 0x06, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10, 0x65, 0xE8, 0x83, 0x55, 0x4F, 0x00, 0x82, 0xE5,
+	0x4F, 0x00, 0x18, 0x34, 0x65, 0x03, 0x82, 0x55, 0x4F, 0x00, 0x18, 0x34, 0x80, 0x20, 0x81, 0x30,
+	0x84, 0xE4, 0x18, 0x18, 0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10,
+	0x65, 0x64, 0x83, 0x55, 0x4F, 0x00, 0x82, 0xE5, 0x4F, 0x00, 0x18, 0x54, 0x80, 0x20, 0x81, 0x30,
+	0x84, 0xE4, 0x18, 0x40, 0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10,
+	0x65, 0x0A, 0x83, 0x55, 0x4F, 0x00, 0x18, 0x6E, 0x81, 0x30, 0x84, 0xE4, 0x18, 0x60, 0xF4, 0x29,
+	0xD6, 0x75, 0x76, 0x06, 0xF1, 0x29, 0xD6, 0x75, 0x00, 0xEE, 0xA8, 0xC8, 0xF1, 0x65, 0x81, 0xE4,
+	0x3F, 0x00, 0x70, 0x01, 0xA8, 0xC8, 0xF1, 0x55, 0x00, 0xEE, 0xA8, 0xC8, 0xF3, 0x65, 0x8E, 0x00,
+	0x8E, 0x25, 0x4F, 0x00, 0x00, 0xEE, 0x3E, 0x00, 0x18, 0xA2, 0x8E, 0x10, 0x8E, 0x35, 0x4F, 0x00,
+	0x00, 0xEE, 0xA8, 0xCA, 0xF1, 0x55, 0x00, 0xEE, 0x8E, 0xE3, 0x62, 0x0F, 0x63, 0xFF, 0x61, 0x10,
+	0xE2, 0xA1, 0x18, 0xC4, 0x81, 0x34, 0x31, 0x00, 0x18, 0xB0, 0x61, 0x10, 0x80, 0x34, 0x30, 0x00,
+	0x18, 0xB0, 0x00, 0xEE, 0x6E, 0x01, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x70,
+	0x20, 0x00, 0x50, 0x70, 0x20, 0x00, 0x60, 0x30, 0x60, 0x00, 0x60, 0x30, 0x60, 0x00, 0x30, 0x60,
+	0x30, 0x00, 0x30, 0x60, 0x30, 0x00, 0x20, 0x70, 0x50, 0x00, 0x20, 0x70, 0x50, 0x00, 0x20, 0x70,
+	0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00,
+	0x00, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x00, 0x80, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x0A, 0x65, 0x05, 0x05, 0x05, 0x05, 0xE5,
+	0x05, 0x05, 0xE5, 0x05, 0x05, 0x05, 0x05, 0xC5, 0x0A, 0x0A, 0x65, 0x05, 0x05, 0x05, 0x05, 0xE5,
+	0x05, 0x05, 0xE5, 0x05, 0x05, 0x05, 0x05, 0xC5, 0x0A, 0x0A, 0x05, 0x0C, 0x08, 0x08, 0x0F, 0x05,
+	0x0C, 0x0D, 0x05, 0x08, 0x08, 0x08, 0x0D, 0x05, 0x0E, 0x0F, 0x05, 0x0C, 0x08, 0x08, 0x0F, 0x05,
+	0x0C, 0x0D, 0x05, 0x08, 0x08, 0x08, 0x0D, 0x05, 0x0A, 0x0A, 0x05, 0x0A, 0x65, 0x06, 0x05, 0x95,
+	0x0A, 0x0A, 0x35, 0x05, 0x05, 0xC5, 0x0A, 0x35, 0x05, 0x05, 0x95, 0x0A, 0x65, 0x05, 0x05, 0x95,
+	0x0A, 0x0A, 0x35, 0x05, 0x06, 0xC5, 0x0A, 0x05, 0x0A, 0x0A, 0x05, 0x0F, 0x05, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x0C, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x0C,
+	0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x0F, 0x05, 0x0A, 0x0A, 0x75, 0x05, 0xB5, 0x05, 0x05, 0x05,
+	0x05, 0xC5, 0x0A, 0x65, 0x05, 0xB5, 0x05, 0xE5, 0x05, 0x05, 0xE5, 0x05, 0xB5, 0x05, 0xC5, 0x0A,
+	0x65, 0x05, 0x05, 0x05, 0x05, 0xB5, 0x05, 0xD5, 0x0A, 0x0A, 0x05, 0x0C, 0x08, 0x08, 0x08, 0x08,
+	0x0D, 0x05, 0x0F, 0x05, 0x0C, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x0D, 0x05, 0x0F,
+	0x05, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x05, 0x0A, 0x0F, 0x05, 0x0F, 0x65, 0x05, 0x05, 0xC5,
+	0x0A, 0x35, 0xE5, 0x95, 0x0A, 0x65, 0x05, 0xB0, 0x05, 0x05, 0xB5, 0x05, 0xC5, 0x0A, 0x35, 0xE5,
+	0x95, 0x0A, 0x65, 0x05, 0x05, 0xC5, 0x0F, 0x05, 0x0F, 0x07, 0x74, 0x05, 0xD5, 0x08, 0x0F, 0x05,
+	0x0E, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x05, 0x08, 0x0F, 0x05,
+	0x08, 0x0F, 0x05, 0x08, 0x0F, 0x75, 0x05, 0xD4, 0x07, 0x0A, 0x05, 0x0A, 0x35, 0x05, 0x05, 0xF5,
+	0x05, 0x05, 0xB5, 0x05, 0x05, 0xD5, 0x08, 0x08, 0x0D, 0x0C, 0x08, 0x0F, 0x75, 0x05, 0x05, 0xB5,
+	0x05, 0x05, 0xF5, 0x05, 0x05, 0x95, 0x0A, 0x05, 0x0A, 0x0A, 0x05, 0x08, 0x08, 0x08, 0x0D, 0x05,
+	0x0C, 0x08, 0x08, 0x08, 0x0D, 0x35, 0x05, 0xC5, 0x0A, 0x0A, 0x65, 0x05, 0x95, 0x0C, 0x08, 0x08,
+	0x08, 0x0D, 0x05, 0x0C, 0x08, 0x08, 0x0F, 0x05, 0x0A, 0x0A, 0x75, 0x05, 0x06, 0xC5, 0x0A, 0x05,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x0F, 0x05, 0x0A, 0x65, 0x06, 0x05, 0xD5, 0x0A, 0x0A, 0x05, 0x0C, 0x0D, 0x05, 0x0A, 0x35,
+	0x05, 0x05, 0x05, 0x05, 0xE5, 0x05, 0x05, 0xF5, 0x05, 0x05, 0xF5, 0x05, 0x05, 0xE5, 0x05, 0x05,
+	0x05, 0x05, 0x95, 0x0A, 0x05, 0x0C, 0x0D, 0x05, 0x0A, 0x0A, 0x05, 0x08, 0x0F, 0x05, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x0F, 0x05, 0x0C, 0x0D, 0x05, 0x08, 0x0F, 0x05, 0x0C, 0x0D, 0x05, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x0A, 0x0A, 0x35, 0x05, 0x05, 0xB5, 0x05, 0x05,
+	0x05, 0x05, 0x05, 0x05, 0x95, 0x0A, 0x0A, 0x35, 0x05, 0x05, 0x95, 0x0A, 0x0A, 0x35, 0x05, 0x05,
+	0x05, 0x05, 0x05, 0x05, 0xB5, 0x05, 0x05, 0x95, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x3C, 0x42, 0x99, 0x99, 0x42, 0x3C, 0x01,
+	0x10, 0x0F, 0x78, 0x84, 0x32, 0x32, 0x84, 0x78, 0x00, 0x10, 0xE0, 0x78, 0xFC, 0xFE, 0xFE, 0x84,
+	0x78, 0x00, 0x10, 0xE0
+};
+
+static constexpr unsigned char rom_BRIX[] = {
+	0x6E, 0x05, 0x65, 0x00, 0x6B, 0x06, 0x6A, 0x00, 0xA3, 0x0C, 0xDA, 0xB1, 0x7A, 0x04, 0x3A, 0x40,
+	0x12, 0x08, 0x7B, 0x02, 0x3B, 0x12, 0x12, 0x06, 0x6C, 0x20, 0x6D, 0x1F, 0xA3, 0x10, 0xDC, 0xD1,
+	0x22, 0xF6, 0x60, 0x00, 0x61, 0x00, 0xA3, 0x12, 0xD0, 0x11, 0x70, 0x08, 0xA3, 0x0E, 0xD0, 0x11,
+	0x60, 0x40, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x34, 0xC6, 0x0F, 0x67, 0x1E, 0x68, 0x01,
+	0x69, 0xFF, 0xA3, 0x0E, 0xD6, 0x71, 0xA3, 0x10, 0xDC, 0xD1, 0x60, 0x04, 0xE0, 0xA1, 0x7C, 0xFE,
+	0x60, 0x06, 0xE0, 0xA1, 0x7C, 0x02, 0x60, 0x3F, 0x8C, 0x02, 0xDC, 0xD1, 0xA3, 0x0E, 0xD6, 0x71,
+	0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02, 0x61, 0x1F, 0x87, 0x12, 0x47, 0x1F, 0x12, 0xAC,
+	0x46, 0x00, 0x68, 0x01, 0x46, 0x3F, 0x68, 0xFF, 0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x3F, 0x01,
+	0x12, 0xAA, 0x47, 0x1F, 0x12, 0xAA, 0x60, 0x05, 0x80, 0x75, 0x3F, 0x00, 0x12, 0xAA, 0x60, 0x01,
+	0xF0, 0x18, 0x80, 0x60, 0x61, 0xFC, 0x80, 0x12, 0xA3, 0x0C, 0xD0, 0x71, 0x60, 0xFE, 0x89, 0x03,
+	0x22, 0xF6, 0x75, 0x01, 0x22, 0xF6, 0x45, 0x60, 0x12, 0xDE, 0x12, 0x46, 0x69, 0xFF, 0x80, 0x60,
+	0x80, 0xC5, 0x3F, 0x01, 0x12, 0xCA, 0x61, 0x02, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xE0, 0x80, 0x15,
+	0x3F, 0x01, 0x12, 0xEE, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xE8, 0x60, 0x20, 0xF0, 0x18, 0xA3, 0x0E,
+	0x7E, 0xFF, 0x80, 0xE0, 0x80, 0x04, 0x61, 0x00, 0xD0, 0x11, 0x3E, 0x00, 0x12, 0x30, 0x12, 0xDE,
+	0x78, 0xFF, 0x48, 0xFE, 0x68, 0xFF, 0x12, 0xEE, 0x78, 0x01, 0x48, 0x02, 0x68, 0x01, 0x60, 0x04,
+	0xF0, 0x18, 0x69, 0xFF, 0x12, 0x70, 0xA3, 0x14, 0xF5, 0x33, 0xF2, 0x65, 0xF1, 0x29, 0x63, 0x37,
+	0x64, 0x00, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x00, 0xEE, 0xE0, 0x00, 0x80, 0x00,
+	0xFC, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr unsigned char rom_CONNECT4[] = {
+	0x12, 0x1A, 0x43, 0x4F, 0x4E, 0x4E, 0x45, 0x43, 0x54, 0x34, 0x20, 0x62, 0x79, 0x20, 0x44, 0x61,
+	0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0xA2, 0xBB, 0xF6, 0x65, 0xA2, 0xB4,
+	0xF6, 0x55, 0x69, 0x00, 0x68, 0x01, 0x6B, 0x00, 0x6D, 0x0F, 0x6E, 0x1F, 0xA2, 0xA5, 0x60, 0x0D,
+	0x61, 0x32, 0x62, 0x00, 0xD0, 0x2F, 0xD1, 0x2F, 0x72, 0x0F, 0x32, 0x1E, 0x12, 0x34, 0xD0, 0x21,
+	0xD1, 0x21, 0x72, 0x01, 0x60, 0x0A, 0xA2, 0x9F, 0xD0, 0x21, 0xD1, 0x21, 0xA2, 0x9F, 0xDD, 0xE1,
+	0xFC, 0x0A, 0xDD, 0xE1, 0x4C, 0x05, 0x12, 0x7E, 0x3C, 0x04, 0x12, 0x6A, 0x7B, 0xFF, 0x7D, 0xFB,
+	0x3D, 0x0A, 0x12, 0x7A, 0x6B, 0x06, 0x6D, 0x2D, 0x12, 0x7A, 0x3C, 0x06, 0x12, 0x98, 0x7B, 0x01,
+	0x7D, 0x05, 0x3D, 0x32, 0x12, 0x7A, 0x6B, 0x00, 0x6D, 0x0F, 0xDD, 0xE1, 0x12, 0x50, 0xA2, 0xB4,
+	0xFB, 0x1E, 0xF0, 0x65, 0x40, 0xFC, 0x12, 0x98, 0x8A, 0x00, 0x70, 0xFB, 0xF0, 0x55, 0x89, 0x83,
+	0xA2, 0x9E, 0x39, 0x00, 0xA2, 0xA1, 0xDD, 0xA4, 0xA2, 0x9F, 0xDD, 0xE1, 0x12, 0x50, 0x60, 0xF0,
+	0xF0, 0x60, 0x90, 0x90, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1A, 0x1A
+};
+
+static constexpr unsigned char rom_GUESS[] = {
+	0x6E, 0x01, 0x00, 0xE0, 0x6D, 0x01, 0x6A, 0x01, 0x6B, 0x01, 0x8C, 0xD0, 0x8C, 0xE2, 0x4C, 0x00,
+	0x12, 0x20, 0x88, 0xD0, 0x22, 0x3E, 0x3A, 0x40, 0x12, 0x20, 0x6A, 0x01, 0x7B, 0x06, 0x3C, 0x3F,
+	0x7D, 0x01, 0x3D, 0x3F, 0x12, 0x0A, 0xF0, 0x0A, 0x40, 0x05, 0x89, 0xE4, 0x8E, 0xE4, 0x3E, 0x40,
+	0x12, 0x02, 0x6A, 0x1C, 0x6B, 0x0D, 0x88, 0x90, 0x00, 0xE0, 0x22, 0x3E, 0x12, 0x3C, 0xA2, 0x94,
+	0xF8, 0x33, 0xF2, 0x65, 0x22, 0x54, 0xDA, 0xB5, 0x7A, 0x04, 0x81, 0x20, 0x22, 0x54, 0xDA, 0xB5,
+	0x7A, 0x05, 0x00, 0xEE, 0x83, 0x10, 0x83, 0x34, 0x83, 0x34, 0x83, 0x14, 0xA2, 0x62, 0xF3, 0x1E,
+	0x00, 0xEE, 0xE0, 0xA0, 0xA0, 0xA0, 0xE0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xE0, 0x20, 0xE0, 0x80,
+	0xE0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xA0, 0xA0, 0xE0, 0x20, 0x20, 0xE0, 0x80, 0xE0, 0x20, 0xE0,
+	0xE0, 0x80, 0xE0, 0xA0, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0xE0, 0xA0, 0xE0, 0xA0, 0xE0, 0xE0,
+	0xA0, 0xE0, 0x20, 0xE0
+};
+
+static constexpr unsigned char rom_HIDDEN[] = {
+	0x12, 0x1D, 0x48, 0x49, 0x44, 0x44, 0x45, 0x4E, 0x21, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x42, 0x79,
+	0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0xA4, 0x3F, 0x60,
+	0x00, 0x61, 0x40, 0xF1, 0x55, 0xA4, 0x3F, 0x60, 0x00, 0xF0, 0x55, 0x00, 0xE0, 0xA4, 0x7E, 0x60,
+	0x0C, 0x61, 0x08, 0x62, 0x0F, 0xD0, 0x1F, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x34, 0x12, 0x35, 0xF0,
+	0x0A, 0x00, 0xE0, 0xA4, 0xC9, 0x60, 0x13, 0x61, 0x0D, 0x62, 0x04, 0xD0, 0x14, 0x70, 0x08, 0xF2,
+	0x1E, 0x30, 0x2B, 0x12, 0x4B, 0xA4, 0x1F, 0xFF, 0x65, 0xA4, 0x2F, 0xFF, 0x55, 0x63, 0x40, 0x66,
+	0x08, 0xC1, 0x0F, 0xC2, 0x0F, 0xA4, 0x2F, 0xF1, 0x1E, 0xF0, 0x65, 0x84, 0x00, 0xA4, 0x2F, 0xF2,
+	0x1E, 0xF0, 0x65, 0x85, 0x00, 0x80, 0x40, 0xF0, 0x55, 0xA4, 0x2F, 0xF1, 0x1E, 0x80, 0x50, 0xF0,
+	0x55, 0x73, 0xFF, 0x33, 0x00, 0x12, 0x61, 0x00, 0xE0, 0x60, 0x00, 0x61, 0x00, 0xA4, 0x77, 0xD0,
+	0x17, 0x70, 0x08, 0x30, 0x20, 0x12, 0x8F, 0x60, 0x00, 0x71, 0x08, 0x31, 0x20, 0x12, 0x8F, 0x6C,
+	0x00, 0x6D, 0x00, 0x6E, 0x00, 0xA4, 0x3F, 0xF0, 0x65, 0x70, 0x01, 0xF0, 0x55, 0x23, 0xB9, 0x6A,
+	0x10, 0x23, 0x5D, 0x23, 0xCD, 0x8A, 0x90, 0x87, 0xD0, 0x88, 0xE0, 0x23, 0x5D, 0x23, 0xCD, 0x23,
+	0xB9, 0xA4, 0x2F, 0xF9, 0x1E, 0xF0, 0x65, 0x81, 0x00, 0xA4, 0x2F, 0xFA, 0x1E, 0xF0, 0x65, 0x50,
+	0x10, 0x13, 0x2B, 0x23, 0xDF, 0x60, 0x20, 0x24, 0x01, 0x23, 0xDF, 0x60, 0x00, 0xA4, 0x2F, 0xF9,
+	0x1E, 0xF0, 0x55, 0xA4, 0x2F, 0xFA, 0x1E, 0xF0, 0x55, 0x76, 0xFF, 0x36, 0x00, 0x12, 0xA5, 0xA4,
+	0x3F, 0xF1, 0x65, 0x82, 0x00, 0x80, 0x15, 0x3F, 0x00, 0x13, 0x01, 0x80, 0x20, 0x81, 0x20, 0xF1,
+	0x55, 0x00, 0xE0, 0xA5, 0x19, 0x60, 0x10, 0x61, 0x07, 0x62, 0x0E, 0xD0, 0x1F, 0x70, 0x08, 0xF2,
+	0x1E, 0x30, 0x30, 0x13, 0x0B, 0xA4, 0x3F, 0xF1, 0x65, 0x84, 0x10, 0x83, 0x00, 0x66, 0x09, 0x24,
+	0x0B, 0x66, 0x0F, 0x83, 0x40, 0x24, 0x0B, 0xF0, 0x0A, 0x12, 0x25, 0x23, 0xDB, 0x60, 0x80, 0x24,
+	0x01, 0x23, 0xDB, 0xA4, 0x2F, 0xFA, 0x1E, 0xF0, 0x65, 0x70, 0xFF, 0x23, 0xF3, 0xA4, 0x41, 0xF0,
+	0x1E, 0xD7, 0x87, 0xA4, 0x77, 0xD7, 0x87, 0xA4, 0x2F, 0xF9, 0x1E, 0xF0, 0x65, 0x70, 0xFF, 0x23,
+	0xF3, 0xA4, 0x41, 0xF0, 0x1E, 0xDD, 0xE7, 0xA4, 0x77, 0xDD, 0xE7, 0x12, 0xA5, 0xA4, 0x71, 0xDD,
+	0xE7, 0xFB, 0x0A, 0xDD, 0xE7, 0x3B, 0x04, 0x13, 0x71, 0x4D, 0x00, 0x13, 0x5D, 0x7D, 0xF8, 0x7C,
+	0xFF, 0x3B, 0x06, 0x13, 0x7D, 0x4D, 0x18, 0x13, 0x5D, 0x7D, 0x08, 0x7C, 0x01, 0x3B, 0x02, 0x13,
+	0x89, 0x4E, 0x00, 0x13, 0x5D, 0x7E, 0xF8, 0x7C, 0xFC, 0x3B, 0x08, 0x13, 0x95, 0x4E, 0x18, 0x13,
+	0x5D, 0x7E, 0x08, 0x7C, 0x04, 0x3B, 0x05, 0x13, 0x5D, 0xA4, 0x2F, 0xFC, 0x1E, 0xF0, 0x65, 0x40,
+	0x00, 0x13, 0x5D, 0x89, 0xC0, 0x99, 0xA0, 0x13, 0x5D, 0x70, 0xFF, 0xA4, 0x77, 0xDD, 0xE7, 0xA4,
+	0x41, 0x23, 0xF3, 0xF0, 0x1E, 0xDD, 0xE7, 0x00, 0xEE, 0xA4, 0xD5, 0x60, 0x24, 0x61, 0x0A, 0x62,
+	0x0B, 0xD0, 0x1B, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x3C, 0x13, 0xC1, 0x00, 0xEE, 0x60, 0x34, 0x61,
+	0x10, 0xA4, 0xF1, 0xD0, 0x15, 0xA4, 0xF6, 0xD0, 0x15, 0x00, 0xEE, 0xA4, 0xFB, 0x13, 0xE1, 0xA5,
+	0x0A, 0x60, 0x24, 0x61, 0x0D, 0x62, 0x05, 0xD0, 0x15, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x3C, 0x13,
+	0xE7, 0x00, 0xEE, 0x81, 0x00, 0x81, 0x14, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x15, 0x00,
+	0xEE, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x14, 0x03, 0x00, 0xEE, 0xA4, 0x2F, 0xF3, 0x33, 0xF2,
+	0x65, 0x65, 0x23, 0xF1, 0x29, 0xD5, 0x65, 0x65, 0x28, 0xF2, 0x29, 0xD5, 0x65, 0x00, 0xEE, 0x01,
+	0x02, 0x03, 0x04, 0x08, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x08, 0x04, 0x03, 0x02, 0x01, 0x01,
+	0x02, 0x03, 0x04, 0x08, 0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x08, 0x04, 0x03, 0x02, 0x01, 0x00,
+	0x00, 0xFE, 0xEE, 0xC6, 0x82, 0xC6, 0xEE, 0xFE, 0xFE, 0xC6, 0xC6, 0xC6, 0xFE, 0xFE, 0xC6, 0xAA,
+	0x82, 0xAA, 0xC6, 0xFE, 0xC6, 0x82, 0x82, 0x82, 0xC6, 0xFE, 0xBA, 0xD6, 0xEE, 0xD6, 0xBA, 0xFE,
+	0xEE, 0xEE, 0x82, 0xEE, 0xEE, 0xFE, 0x82, 0xFE, 0x82, 0xFE, 0x82, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA,
+	0xAA, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xAA, 0xD6, 0xAA, 0xD6, 0xAA, 0xFE, 0x8B, 0x88,
+	0xF8, 0x88, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x48, 0x48, 0x48, 0xF2, 0xEF, 0x84, 0x84,
+	0x84, 0xEF, 0x00, 0x08, 0x08, 0x0A, 0x00, 0x8A, 0x8A, 0xAA, 0xAA, 0x52, 0x3C, 0x92, 0x92, 0x92,
+	0x3C, 0x00, 0xE2, 0xA3, 0xE3, 0x00, 0x8B, 0xC8, 0xA8, 0x98, 0x88, 0xFA, 0x83, 0xE2, 0x82, 0xFA,
+	0x00, 0x28, 0xB8, 0x90, 0x00, 0xEF, 0x88, 0x8E, 0x88, 0x8F, 0x21, 0x21, 0xA1, 0x60, 0x21, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xBC, 0x22, 0x3C, 0x28, 0xA4, 0x89, 0x8A, 0xAB, 0x52, 0x97, 0x51, 0xD1,
+	0x51, 0xC0, 0x00, 0x00, 0x15, 0x6A, 0x8A, 0x8E, 0x8A, 0x6A, 0x00, 0x64, 0x8A, 0x8E, 0x8A, 0x6A,
+	0x44, 0xAA, 0xAA, 0xAA, 0x44, 0x00, 0xCC, 0xAA, 0xCA, 0xAA, 0xAC, 0x6E, 0x88, 0x4C, 0x28, 0xCE,
+	0x00, 0x04, 0x0C, 0x04, 0x04, 0x0E, 0x0C, 0x12, 0x04, 0x08, 0x1E, 0x63, 0x94, 0x94, 0x94, 0x63,
+	0x38, 0xA5, 0xB8, 0xA0, 0x21, 0xE1, 0x01, 0xC1, 0x20, 0xC1, 0x89, 0x8A, 0x52, 0x22, 0x21, 0xCF,
+	0x28, 0x2F, 0x28, 0xC8, 0x02, 0x82, 0x02, 0x00, 0x02, 0xFF, 0x80, 0x8F, 0x90, 0x8E, 0x81, 0x9E,
+	0x80, 0x91, 0x91, 0x9F, 0x91, 0x91, 0x80, 0xFF, 0x00, 0x3C, 0x40, 0x40, 0x40, 0x3C, 0x00, 0x7C,
+	0x10, 0x10, 0x10, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x80, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0xFF
+};
+
+static constexpr unsigned char rom_INVADERS[] = {
+	0x12, 0x25, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x49, 0x4E, 0x56, 0x41, 0x44, 0x45, 0x52, 0x53,
+	0x20, 0x76, 0x30, 0x2E, 0x39, 0x20, 0x42, 0x79, 0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57,
+	0x49, 0x4E, 0x54, 0x45, 0x52, 0x60, 0x00, 0x61, 0x00, 0x62, 0x08, 0xA3, 0xD3, 0xD0, 0x18, 0x71,
+	0x08, 0xF2, 0x1E, 0x31, 0x20, 0x12, 0x2D, 0x70, 0x08, 0x61, 0x00, 0x30, 0x40, 0x12, 0x2D, 0x69,
+	0x05, 0x6C, 0x15, 0x6E, 0x00, 0x23, 0x87, 0x60, 0x0A, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12,
+	0x4B, 0x23, 0x87, 0x7E, 0x01, 0x12, 0x45, 0x66, 0x00, 0x68, 0x1C, 0x69, 0x00, 0x6A, 0x04, 0x6B,
+	0x0A, 0x6C, 0x04, 0x6D, 0x3C, 0x6E, 0x0F, 0x00, 0xE0, 0x23, 0x6B, 0x23, 0x47, 0xFD, 0x15, 0x60,
+	0x04, 0xE0, 0x9E, 0x12, 0x7D, 0x23, 0x6B, 0x38, 0x00, 0x78, 0xFF, 0x23, 0x6B, 0x60, 0x06, 0xE0,
+	0x9E, 0x12, 0x8B, 0x23, 0x6B, 0x38, 0x39, 0x78, 0x01, 0x23, 0x6B, 0x36, 0x00, 0x12, 0x9F, 0x60,
+	0x05, 0xE0, 0x9E, 0x12, 0xE9, 0x66, 0x01, 0x65, 0x1B, 0x84, 0x80, 0xA3, 0xCF, 0xD4, 0x51, 0xA3,
+	0xCF, 0xD4, 0x51, 0x75, 0xFF, 0x35, 0xFF, 0x12, 0xAD, 0x66, 0x00, 0x12, 0xE9, 0xD4, 0x51, 0x3F,
+	0x01, 0x12, 0xE9, 0xD4, 0x51, 0x66, 0x00, 0x83, 0x40, 0x73, 0x03, 0x83, 0xB5, 0x62, 0xF8, 0x83,
+	0x22, 0x62, 0x08, 0x33, 0x00, 0x12, 0xC9, 0x23, 0x73, 0x82, 0x06, 0x43, 0x08, 0x12, 0xD3, 0x33,
+	0x10, 0x12, 0xD5, 0x23, 0x73, 0x82, 0x06, 0x33, 0x18, 0x12, 0xDD, 0x23, 0x73, 0x82, 0x06, 0x43,
+	0x20, 0x12, 0xE7, 0x33, 0x28, 0x12, 0xE9, 0x23, 0x73, 0x3E, 0x00, 0x13, 0x07, 0x79, 0x06, 0x49,
+	0x18, 0x69, 0x00, 0x6A, 0x04, 0x6B, 0x0A, 0x6C, 0x04, 0x7D, 0xF4, 0x6E, 0x0F, 0x00, 0xE0, 0x23,
+	0x47, 0x23, 0x6B, 0xFD, 0x15, 0x12, 0x6F, 0xF7, 0x07, 0x37, 0x00, 0x12, 0x6F, 0xFD, 0x15, 0x23,
+	0x47, 0x8B, 0xA4, 0x3B, 0x12, 0x13, 0x1B, 0x7C, 0x02, 0x6A, 0xFC, 0x3B, 0x02, 0x13, 0x23, 0x7C,
+	0x02, 0x6A, 0x04, 0x23, 0x47, 0x3C, 0x18, 0x12, 0x6F, 0x00, 0xE0, 0xA4, 0xD3, 0x60, 0x14, 0x61,
+	0x08, 0x62, 0x0F, 0xD0, 0x1F, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x2C, 0x13, 0x33, 0xF0, 0x0A, 0x00,
+	0xE0, 0xA6, 0xF4, 0xFE, 0x65, 0x12, 0x25, 0xA3, 0xB7, 0xF9, 0x1E, 0x61, 0x08, 0x23, 0x5F, 0x81,
+	0x06, 0x23, 0x5F, 0x81, 0x06, 0x23, 0x5F, 0x81, 0x06, 0x23, 0x5F, 0x7B, 0xD0, 0x00, 0xEE, 0x80,
+	0xE0, 0x80, 0x12, 0x30, 0x00, 0xDB, 0xC6, 0x7B, 0x0C, 0x00, 0xEE, 0xA3, 0xCF, 0x60, 0x1C, 0xD8,
+	0x04, 0x00, 0xEE, 0x23, 0x47, 0x8E, 0x23, 0x23, 0x47, 0x60, 0x05, 0xF0, 0x18, 0xF0, 0x15, 0xF0,
+	0x07, 0x30, 0x00, 0x13, 0x7F, 0x00, 0xEE, 0x6A, 0x00, 0x8D, 0xE0, 0x6B, 0x04, 0xE9, 0xA1, 0x12,
+	0x57, 0xA6, 0x02, 0xFD, 0x1E, 0xF0, 0x65, 0x30, 0xFF, 0x13, 0xA5, 0x6A, 0x00, 0x6B, 0x04, 0x6D,
+	0x01, 0x6E, 0x01, 0x13, 0x8D, 0xA5, 0x00, 0xF0, 0x1E, 0xDB, 0xC6, 0x7B, 0x08, 0x7D, 0x01, 0x7A,
+	0x01, 0x3A, 0x07, 0x13, 0x8D, 0x00, 0xEE, 0x3C, 0x7E, 0xFF, 0xFF, 0x99, 0x99, 0x7E, 0xFF, 0xFF,
+	0x24, 0x24, 0xE7, 0x7E, 0xFF, 0x3C, 0x3C, 0x7E, 0xDB, 0x81, 0x42, 0x3C, 0x7E, 0xFF, 0xDB, 0x10,
+	0x38, 0x7C, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F,
+	0x08, 0x08, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x42, 0x42,
+	0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x7D, 0x00, 0x41, 0x7D, 0x05, 0x7D, 0x7D, 0x00, 0x00, 0xC2, 0xC2, 0xC6,
+	0x44, 0x6C, 0x28, 0x38, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xF7, 0x10, 0x14, 0xF7, 0xF7, 0x04, 0x04, 0x00, 0x00, 0x7C, 0x44, 0xFE,
+	0xC2, 0xC2, 0xC2, 0xC2, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xEF, 0x20, 0x28, 0xE8, 0xE8, 0x2F, 0x2F, 0x00, 0x00, 0xF9, 0x85, 0xC5,
+	0xC5, 0xC5, 0xC5, 0xF9, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0x20, 0x30, 0x20, 0xBE, 0xBE, 0x00, 0x00, 0xF7, 0x04, 0xE7,
+	0x85, 0x85, 0x84, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xEF, 0x28, 0xEF,
+	0x00, 0xE0, 0x60, 0x6F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFC,
+	0x10, 0x10, 0xFF, 0xF9, 0x81, 0xB9, 0x8B, 0x9A, 0x9A, 0xFA, 0x00, 0xFA, 0x8A, 0x9A, 0x9A, 0x9B,
+	0x99, 0xF8, 0xE6, 0x25, 0x25, 0xF4, 0x34, 0x34, 0x34, 0x00, 0x17, 0x14, 0x34, 0x37, 0x36, 0x26,
+	0xC7, 0xDF, 0x50, 0x50, 0x5C, 0xD8, 0xD8, 0xDF, 0x00, 0xDF, 0x11, 0x1F, 0x12, 0x1B, 0x19, 0xD9,
+	0x7C, 0x44, 0xFE, 0x86, 0x86, 0x86, 0xFC, 0x84, 0xFE, 0x82, 0x82, 0xFE, 0xFE, 0x80, 0xC0, 0xC0,
+	0xC0, 0xFE, 0xFC, 0x82, 0xC2, 0xC2, 0xC2, 0xFC, 0xFE, 0x80, 0xF8, 0xC0, 0xC0, 0xFE, 0xFE, 0x80,
+	0xF0, 0xC0, 0xC0, 0xC0, 0xFE, 0x80, 0xBE, 0x86, 0x86, 0xFE, 0x86, 0x86, 0xFE, 0x86, 0x86, 0x86,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x48, 0x48, 0x78, 0x9C, 0x90, 0xB0, 0xC0,
+	0xB0, 0x9C, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFE, 0xEE, 0x92, 0x92, 0x86, 0x86, 0x86, 0xFE, 0x82,
+	0x86, 0x86, 0x86, 0x86, 0x7C, 0x82, 0x86, 0x86, 0x86, 0x7C, 0xFE, 0x82, 0xFE, 0xC0, 0xC0, 0xC0,
+	0x7C, 0x82, 0xC2, 0xCA, 0xC4, 0x7A, 0xFE, 0x86, 0xFE, 0x90, 0x9C, 0x84, 0xFE, 0xC0, 0xFE, 0x02,
+	0x02, 0xFE, 0xFE, 0x10, 0x30, 0x30, 0x30, 0x30, 0x82, 0x82, 0xC2, 0xC2, 0xC2, 0xFE, 0x82, 0x82,
+	0x82, 0xEE, 0x38, 0x10, 0x86, 0x86, 0x96, 0x92, 0x92, 0xEE, 0x82, 0x44, 0x38, 0x38, 0x44, 0x82,
+	0x82, 0x82, 0xFE, 0x30, 0x30, 0x30, 0xFE, 0x02, 0x1E, 0xF0, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x06, 0x00, 0x00, 0x00, 0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x00, 0x18, 0x7C, 0xC6, 0x0C, 0x18, 0x00, 0x18, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00,
+	0xFE, 0x82, 0x86, 0x86, 0x86, 0xFE, 0x08, 0x08, 0x08, 0x18, 0x18, 0x18, 0xFE, 0x02, 0xFE, 0xC0,
+	0xC0, 0xFE, 0xFE, 0x02, 0x1E, 0x06, 0x06, 0xFE, 0x84, 0xC4, 0xC4, 0xFE, 0x04, 0x04, 0xFE, 0x80,
+	0xFE, 0x06, 0x06, 0xFE, 0xC0, 0xC0, 0xC0, 0xFE, 0x82, 0xFE, 0xFE, 0x02, 0x02, 0x06, 0x06, 0x06,
+	0x7C, 0x44, 0xFE, 0x86, 0x86, 0xFE, 0xFE, 0x82, 0xFE, 0x06, 0x06, 0x06, 0x44, 0xFE, 0x44, 0x44,
+	0xFE, 0x44, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x6C, 0x5A, 0x00, 0x0C, 0x18, 0xA8, 0x30,
+	0x4E, 0x7E, 0x00, 0x12, 0x18, 0x66, 0x6C, 0xA8, 0x5A, 0x66, 0x54, 0x24, 0x66, 0x00, 0x48, 0x48,
+	0x18, 0x12, 0xA8, 0x06, 0x90, 0xA8, 0x12, 0x00, 0x7E, 0x30, 0x12, 0xA8, 0x84, 0x30, 0x4E, 0x72,
+	0x18, 0x66, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x90, 0x54, 0x78, 0xA8, 0x48, 0x78, 0x6C, 0x72,
+	0xA8, 0x12, 0x18, 0x6C, 0x72, 0x66, 0x54, 0x90, 0xA8, 0x72, 0x2A, 0x18, 0xA8, 0x30, 0x4E, 0x7E,
+	0x00, 0x12, 0x18, 0x66, 0x6C, 0xA8, 0x72, 0x54, 0xA8, 0x5A, 0x66, 0x18, 0x7E, 0x18, 0x4E, 0x72,
+	0xA8, 0x72, 0x2A, 0x18, 0x30, 0x66, 0xA8, 0x30, 0x4E, 0x7E, 0x00, 0x6C, 0x30, 0x54, 0x4E, 0x9C,
+	0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x48, 0x54, 0x7E, 0x18, 0xA8, 0x90, 0x54, 0x78, 0x66,
+	0xA8, 0x6C, 0x2A, 0x30, 0x5A, 0xA8, 0x84, 0x30, 0x72, 0x2A, 0xA8, 0xD8, 0xA8, 0x00, 0x4E, 0x12,
+	0xA8, 0xE4, 0xA2, 0xA8, 0x00, 0x4E, 0x12, 0xA8, 0x6C, 0x2A, 0x54, 0x54, 0x72, 0xA8, 0x84, 0x30,
+	0x72, 0x2A, 0xA8, 0xDE, 0x9C, 0xA8, 0x72, 0x2A, 0x18, 0xA8, 0x0C, 0x54, 0x48, 0x5A, 0x78, 0x72,
+	0x18, 0x66, 0xA8, 0x72, 0x18, 0x42, 0x42, 0x6C, 0xA8, 0x72, 0x2A, 0x00, 0x72, 0xA8, 0x72, 0x2A,
+	0x18, 0xA8, 0x30, 0x4E, 0x7E, 0x00, 0x12, 0x18, 0x66, 0x6C, 0xA8, 0x30, 0x4E, 0x0C, 0x66, 0x18,
+	0x00, 0x6C, 0x18, 0xA8, 0x72, 0x2A, 0x18, 0x30, 0x66, 0xA8, 0x1E, 0x54, 0x66, 0x0C, 0x18, 0x9C,
+	0xA8, 0x24, 0x54, 0x54, 0x12, 0xA8, 0x42, 0x78, 0x0C, 0x3C, 0xA8, 0xAE, 0xA8, 0xA8, 0xA8, 0xA8,
+	0xA8, 0xA8, 0xA8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00
+};
+
+static constexpr unsigned char rom_KALEID[] = {
+	0x60, 0x00, 0x63, 0x80, 0x61, 0x1F, 0x62, 0x0F, 0x22, 0x32, 0xA2, 0x00, 0xF3, 0x1E, 0xF0, 0x0A,
+	0xF0, 0x55, 0x40, 0x00, 0x12, 0x1C, 0x73, 0x01, 0x33, 0x00, 0x12, 0x08, 0x63, 0x80, 0xA2, 0x00,
+	0xF3, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x12, 0x1C, 0x73, 0x01, 0x43, 0x00, 0x12, 0x1C, 0x22, 0x32,
+	0x12, 0x1E, 0x40, 0x02, 0x72, 0xFF, 0x40, 0x04, 0x71, 0xFF, 0x40, 0x06, 0x71, 0x01, 0x40, 0x08,
+	0x72, 0x01, 0xA2, 0x77, 0x6A, 0xE0, 0x8A, 0x12, 0x6B, 0x1F, 0x81, 0xB2, 0x3A, 0x00, 0x72, 0x01,
+	0x6A, 0xF0, 0x8A, 0x22, 0x6B, 0x0F, 0x82, 0xB2, 0x3A, 0x00, 0x71, 0x01, 0x6B, 0x1F, 0x81, 0xB2,
+	0xD1, 0x21, 0x8A, 0x10, 0x6B, 0x1F, 0x8B, 0x25, 0xDA, 0xB1, 0x6A, 0x3F, 0x8A, 0x15, 0xDA, 0xB1,
+	0x8B, 0x20, 0xDA, 0xB1, 0x00, 0xEE, 0x01, 0x80
+};
+
+static constexpr unsigned char rom_MAZE[] = {
+	0xA2, 0x1E, 0xC2, 0x01, 0x32, 0x01, 0xA2, 0x1A, 0xD0, 0x14, 0x70, 0x04, 0x30, 0x40, 0x12, 0x00,
+	0x60, 0x00, 0x71, 0x04, 0x31, 0x20, 0x12, 0x00, 0x12, 0x18, 0x80, 0x40, 0x20, 0x10, 0x20, 0x40,
+	0x80, 0x10
+};
+
+static constexpr unsigned char rom_MERLIN[] = {
+	0x12, 0x19, 0x20, 0x4D, 0x45, 0x52, 0x4C, 0x49, 0x4E, 0x20, 0x42, 0x79, 0x20, 0x44, 0x61, 0x76,
+	0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0x22, 0xF9, 0xA3, 0x1D, 0x60, 0x10, 0x61,
+	0x00, 0x22, 0xCB, 0xA3, 0x31, 0x60, 0x0B, 0x61, 0x1B, 0x22, 0xCB, 0x64, 0x04, 0x22, 0xDF, 0x65,
+	0x00, 0x62, 0x28, 0x22, 0xC1, 0xC2, 0x03, 0x80, 0x20, 0xA3, 0x59, 0xF5, 0x1E, 0xF0, 0x55, 0x60,
+	0x17, 0x61, 0x08, 0x63, 0x01, 0x83, 0x22, 0x33, 0x00, 0x70, 0x0A, 0x63, 0x02, 0x83, 0x22, 0x33,
+	0x00, 0x71, 0x0A, 0xA3, 0x17, 0xD0, 0x16, 0x62, 0x14, 0x22, 0xC1, 0xD0, 0x16, 0x62, 0x05, 0x22,
+	0xC1, 0x75, 0x01, 0x54, 0x50, 0x12, 0x35, 0x65, 0x00, 0x60, 0x17, 0x61, 0x08, 0xA3, 0x17, 0xF3,
+	0x0A, 0x33, 0x04, 0x12, 0x79, 0x63, 0x00, 0x12, 0x97, 0x33, 0x05, 0x12, 0x83, 0x70, 0x0A, 0x63,
+	0x01, 0x12, 0x97, 0x33, 0x07, 0x12, 0x8D, 0x71, 0x0A, 0x63, 0x02, 0x12, 0x97, 0x33, 0x08, 0x12,
+	0x69, 0x70, 0x0A, 0x71, 0x0A, 0x63, 0x03, 0xD0, 0x16, 0x62, 0x14, 0x22, 0xC1, 0xD0, 0x16, 0xA3,
+	0x59, 0xF5, 0x1E, 0xF0, 0x65, 0x75, 0x01, 0x50, 0x30, 0x12, 0xB5, 0x55, 0x40, 0x12, 0x69, 0x22,
+	0xDF, 0x74, 0x01, 0x12, 0x2D, 0x22, 0xF9, 0xA3, 0x45, 0x60, 0x10, 0x61, 0x0E, 0x22, 0xCB, 0x12,
+	0xBF, 0xF2, 0x15, 0xF2, 0x07, 0x32, 0x00, 0x12, 0xC3, 0x00, 0xEE, 0x83, 0x00, 0x62, 0x05, 0xD0,
+	0x15, 0xF2, 0x1E, 0x70, 0x08, 0x85, 0x30, 0x75, 0x20, 0x50, 0x50, 0x12, 0xCF, 0x00, 0xEE, 0xA3,
+	0x59, 0x83, 0x40, 0x73, 0xFD, 0xF3, 0x33, 0xF2, 0x65, 0xF1, 0x29, 0x60, 0x2B, 0x63, 0x1B, 0xD0,
+	0x35, 0x70, 0x05, 0xF2, 0x29, 0xD0, 0x35, 0x00, 0xEE, 0xA3, 0x0F, 0x60, 0x17, 0x61, 0x07, 0xD0,
+	0x18, 0x70, 0x0A, 0xD0, 0x18, 0x71, 0x0A, 0xD0, 0x18, 0x70, 0xF6, 0xD0, 0x18, 0x00, 0xEE, 0xFF,
+	0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xDB, 0xAA, 0x8B,
+	0xCB, 0xCB, 0xEF, 0x08, 0x8F, 0x0D, 0xEC, 0xA0, 0xA0, 0xB0, 0x30, 0xBE, 0x5F, 0x51, 0x51, 0xD9,
+	0xD9, 0x83, 0x82, 0x83, 0x82, 0xFB, 0xE8, 0x08, 0x88, 0x05, 0xE2, 0xBE, 0xA0, 0xB8, 0x20, 0x3E,
+	0x80, 0x80, 0x80, 0x80, 0xF8, 0xF7, 0x85, 0xB7, 0x95, 0xF5, 0x76, 0x54, 0x56, 0x54, 0x56, 0x3A,
+	0x2A, 0x2A, 0x2A, 0x39, 0xB6, 0xA5, 0xB6, 0xA5, 0x35
+};
+
+static constexpr unsigned char rom_MISSILE[] = {
+	0x12, 0x19, 0x4D, 0x49, 0x53, 0x53, 0x49, 0x4C, 0x45, 0x20, 0x62, 0x79, 0x20, 0x44, 0x61, 0x76,
+	0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0x6C, 0x0C, 0x60, 0x00, 0x61, 0x00, 0x65,
+	0x08, 0x66, 0x0A, 0x67, 0x00, 0x6E, 0x01, 0xA2, 0xAD, 0xD0, 0x14, 0x70, 0x08, 0x30, 0x40, 0x12,
+	0x29, 0x60, 0x00, 0x61, 0x1C, 0xA2, 0xB0, 0xD0, 0x14, 0xA2, 0xB0, 0xD0, 0x14, 0x3E, 0x01, 0x12,
+	0x49, 0x70, 0x04, 0x40, 0x38, 0x6E, 0x00, 0x12, 0x4F, 0x70, 0xFC, 0x40, 0x00, 0x6E, 0x01, 0xD0,
+	0x14, 0xFC, 0x15, 0xFB, 0x07, 0x3B, 0x00, 0x12, 0x53, 0x62, 0x08, 0xE2, 0x9E, 0x12, 0x95, 0x3C,
+	0x00, 0x7C, 0xFE, 0x63, 0x1B, 0x82, 0x00, 0xA2, 0xB0, 0xD2, 0x31, 0x64, 0x00, 0xD2, 0x31, 0x73,
+	0xFF, 0xD2, 0x31, 0x3F, 0x00, 0x64, 0x01, 0x33, 0x03, 0x12, 0x6D, 0xD2, 0x31, 0x34, 0x01, 0x12,
+	0x91, 0x77, 0x05, 0x75, 0xFF, 0x82, 0x00, 0x63, 0x00, 0xA2, 0xAD, 0xD2, 0x34, 0x45, 0x00, 0x12,
+	0x97, 0x76, 0xFF, 0x36, 0x00, 0x12, 0x39, 0xA2, 0xB4, 0xF7, 0x33, 0xF2, 0x65, 0x63, 0x1B, 0x64,
+	0x0D, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x12, 0xAB, 0x10, 0x38, 0x38,
+	0x10, 0x38, 0x7C, 0xFE
+};
+
+static constexpr unsigned char rom_PONG[] = {
+	0x6A, 0x02, 0x6B, 0x0C, 0x6C, 0x3F, 0x6D, 0x0C, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6, 0x6E, 0x00,
+	0x22, 0xD4, 0x66, 0x03, 0x68, 0x02, 0x60, 0x60, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x1A,
+	0xC7, 0x17, 0x77, 0x08, 0x69, 0xFF, 0xA2, 0xF0, 0xD6, 0x71, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6,
+	0x60, 0x01, 0xE0, 0xA1, 0x7B, 0xFE, 0x60, 0x04, 0xE0, 0xA1, 0x7B, 0x02, 0x60, 0x1F, 0x8B, 0x02,
+	0xDA, 0xB6, 0x60, 0x0C, 0xE0, 0xA1, 0x7D, 0xFE, 0x60, 0x0D, 0xE0, 0xA1, 0x7D, 0x02, 0x60, 0x1F,
+	0x8D, 0x02, 0xDC, 0xD6, 0xA2, 0xF0, 0xD6, 0x71, 0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02,
+	0x61, 0x1F, 0x87, 0x12, 0x46, 0x02, 0x12, 0x78, 0x46, 0x3F, 0x12, 0x82, 0x47, 0x1F, 0x69, 0xFF,
+	0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x12, 0x2A, 0x68, 0x02, 0x63, 0x01, 0x80, 0x70, 0x80, 0xB5,
+	0x12, 0x8A, 0x68, 0xFE, 0x63, 0x0A, 0x80, 0x70, 0x80, 0xD5, 0x3F, 0x01, 0x12, 0xA2, 0x61, 0x02,
+	0x80, 0x15, 0x3F, 0x01, 0x12, 0xBA, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xC8, 0x80, 0x15, 0x3F, 0x01,
+	0x12, 0xC2, 0x60, 0x20, 0xF0, 0x18, 0x22, 0xD4, 0x8E, 0x34, 0x22, 0xD4, 0x66, 0x3E, 0x33, 0x01,
+	0x66, 0x03, 0x68, 0xFE, 0x33, 0x01, 0x68, 0x02, 0x12, 0x16, 0x79, 0xFF, 0x49, 0xFE, 0x69, 0xFF,
+	0x12, 0xC8, 0x79, 0x01, 0x49, 0x02, 0x69, 0x01, 0x60, 0x04, 0xF0, 0x18, 0x76, 0x01, 0x46, 0x40,
+	0x76, 0xFE, 0x12, 0x6C, 0xA2, 0xF2, 0xFE, 0x33, 0xF2, 0x65, 0xF1, 0x29, 0x64, 0x14, 0x65, 0x00,
+	0xD4, 0x55, 0x74, 0x15, 0xF2, 0x29, 0xD4, 0x55, 0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr unsigned char rom_PONG2[] = {
+	0x22, 0xF6, 0x6B, 0x0C, 0x6C, 0x3F, 0x6D, 0x0C, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6, 0x6E, 0x00,
+	0x22, 0xD4, 0x66, 0x03, 0x68, 0x02, 0x60, 0x60, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x1A,
+	0xC7, 0x17, 0x77, 0x08, 0x69, 0xFF, 0xA2, 0xF0, 0xD6, 0x71, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6,
+	0x60, 0x01, 0xE0, 0xA1, 0x7B, 0xFE, 0x60, 0x04, 0xE0, 0xA1, 0x7B, 0x02, 0x60, 0x1F, 0x8B, 0x02,
+	0xDA, 0xB6, 0x60, 0x0C, 0xE0, 0xA1, 0x7D, 0xFE, 0x60, 0x0D, 0xE0, 0xA1, 0x7D, 0x02, 0x60, 0x1F,
+	0x8D, 0x02, 0xDC, 0xD6, 0xA2, 0xF0, 0xD6, 0x71, 0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02,
+	0x61, 0x1F, 0x87, 0x12, 0x46, 0x00, 0x12, 0x78, 0x46, 0x3F, 0x12, 0x82, 0x47, 0x1F, 0x69, 0xFF,
+	0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x12, 0x2A, 0x68, 0x02, 0x63, 0x01, 0x80, 0x70, 0x80, 0xB5,
+	0x12, 0x8A, 0x68, 0xFE, 0x63, 0x0A, 0x80, 0x70, 0x80, 0xD5, 0x3F, 0x01, 0x12, 0xA2, 0x61, 0x02,
+	0x80, 0x15, 0x3F, 0x01, 0x12, 0xBA, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xC8, 0x80, 0x15, 0x3F, 0x01,
+	0x12, 0xC2, 0x60, 0x20, 0xF0, 0x18, 0x22, 0xD4, 0x8E, 0x34, 0x22, 0xD4, 0x66, 0x3E, 0x33, 0x01,
+	0x66, 0x03, 0x68, 0xFE, 0x33, 0x01, 0x68, 0x02, 0x12, 0x16, 0x79, 0xFF, 0x49, 0xFE, 0x69, 0xFF,
+	0x12, 0xC8, 0x79, 0x01, 0x49, 0x02, 0x69, 0x01, 0x60, 0x04, 0xF0, 0x18, 0x76, 0x01, 0x46, 0x40,
+	0x76, 0xFE, 0x12, 0x6C, 0xA2, 0xF2, 0xFE, 0x33, 0xF2, 0x65, 0xF1, 0x29, 0x64, 0x14, 0x65, 0x00,
+	0xD4, 0x55, 0x74, 0x15, 0xF2, 0x29, 0xD4, 0x55, 0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x20, 0x6C, 0x00, 0xA2, 0xEA, 0xDB, 0xC1, 0x7C, 0x01,
+	0x3C, 0x20, 0x12, 0xFC, 0x6A, 0x00, 0x00, 0xEE
+};
+
+static constexpr unsigned char rom_PUZZLE[] = {
+	0x6A, 0x12, 0x6B, 0x01, 0x61, 0x10, 0x62, 0x00, 0x60, 0x00, 0xA2, 0xB0, 0xD1, 0x27, 0xF0, 0x29,
+	0x30, 0x00, 0xDA, 0xB5, 0x71, 0x08, 0x7A, 0x08, 0x31, 0x30, 0x12, 0x24, 0x61, 0x10, 0x72, 0x08,
+	0x6A, 0x12, 0x7B, 0x08, 0xA3, 0x00, 0xF0, 0x1E, 0xF0, 0x55, 0x70, 0x01, 0x30, 0x10, 0x12, 0x0A,
+	0x6A, 0x12, 0x6B, 0x01, 0x6C, 0x00, 0x62, 0xFF, 0xC0, 0x06, 0x70, 0x02, 0x22, 0x52, 0x72, 0xFF,
+	0x32, 0x00, 0x12, 0x38, 0x6E, 0x00, 0x6E, 0x00, 0xF0, 0x0A, 0x22, 0x52, 0x7E, 0x01, 0x7E, 0x01,
+	0x12, 0x48, 0x84, 0xA0, 0x85, 0xB0, 0x86, 0xC0, 0x30, 0x02, 0x12, 0x64, 0x45, 0x01, 0x12, 0x64,
+	0x75, 0xF8, 0x76, 0xFC, 0x30, 0x08, 0x12, 0x70, 0x45, 0x19, 0x12, 0x70, 0x75, 0x08, 0x76, 0x04,
+	0x30, 0x06, 0x12, 0x7C, 0x44, 0x12, 0x12, 0x7C, 0x74, 0xF8, 0x76, 0xFF, 0x30, 0x04, 0x12, 0x88,
+	0x44, 0x2A, 0x12, 0x88, 0x74, 0x08, 0x76, 0x01, 0xA3, 0x00, 0xF6, 0x1E, 0xF0, 0x65, 0x81, 0x00,
+	0x60, 0x00, 0xA3, 0x00, 0xF6, 0x1E, 0xF0, 0x55, 0xA3, 0x00, 0xFC, 0x1E, 0x80, 0x10, 0xF0, 0x55,
+	0xF1, 0x29, 0xD4, 0x55, 0xDA, 0xB5, 0x8A, 0x40, 0x8B, 0x50, 0x8C, 0x60, 0x00, 0xEE, 0xEE, 0x5E,
+	0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE
+};
+
+static constexpr unsigned char rom_TANK[] = {
+	0x12, 0x30, 0x76, 0xFB, 0x60, 0x20, 0x80, 0x65, 0x4F, 0x00, 0x66, 0x00, 0x13, 0x84, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x0A, 0x00, 0x19, 0x02, 0x04, 0x06, 0x08, 0x02, 0x02, 0x03,
+	0x2C, 0x00, 0x0F, 0x00, 0x02, 0x05, 0x2E, 0x08, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x6E, 0x00, 0x6D, 0xA0, 0x6A, 0x08, 0x69, 0x06, 0x68, 0x04, 0x67, 0x02, 0x66, 0x19, 0x64, 0x10,
+	0x63, 0x0C, 0x62, 0x00, 0x61, 0x06, 0xA2, 0x12, 0xFA, 0x55, 0x23, 0xD4, 0x60, 0x40, 0xF0, 0x15,
+	0xF0, 0x07, 0x30, 0x00, 0x12, 0x50, 0x23, 0xD4, 0x23, 0x0A, 0x23, 0x62, 0xA2, 0x12, 0xF5, 0x65,
+	0x22, 0xAE, 0x22, 0xC6, 0x22, 0xEC, 0x3F, 0x01, 0x23, 0x14, 0x3F, 0x01, 0x22, 0xEC, 0x3F, 0x01,
+	0x22, 0xEC, 0x3F, 0x01, 0x22, 0x7C, 0x4F, 0x01, 0x13, 0x66, 0x12, 0x62, 0xA2, 0x12, 0xF5, 0x65,
+	0x46, 0x00, 0x35, 0x00, 0x12, 0x88, 0x13, 0x8C, 0xE7, 0xA1, 0x62, 0x09, 0xE8, 0xA1, 0x62, 0x04,
+	0xE9, 0xA1, 0x62, 0x06, 0xEA, 0xA1, 0x62, 0x01, 0x42, 0x00, 0x00, 0xEE, 0x22, 0xAE, 0x81, 0x20,
+	0x23, 0x9A, 0x23, 0xAC, 0x6C, 0x01, 0x62, 0x00, 0x6F, 0x00, 0xA2, 0x12, 0xF5, 0x55, 0xA3, 0xFF,
+	0x41, 0x01, 0x60, 0x00, 0x41, 0x04, 0x60, 0x13, 0x41, 0x06, 0x60, 0x0D, 0x41, 0x09, 0x60, 0x06,
+	0xF0, 0x1E, 0xD3, 0x47, 0x00, 0xEE, 0x60, 0x05, 0xE0, 0x9E, 0x00, 0xEE, 0x45, 0x0F, 0x00, 0xEE,
+	0x65, 0x0F, 0x76, 0xFF, 0xA2, 0x12, 0xF5, 0x55, 0x74, 0x03, 0x73, 0x03, 0x23, 0x9A, 0x23, 0x9A,
+	0x23, 0x9A, 0xA2, 0x23, 0xF5, 0x55, 0xA4, 0x19, 0xD3, 0x41, 0x00, 0xEE, 0xA2, 0x23, 0xF5, 0x65,
+	0x45, 0x00, 0x00, 0xEE, 0xA4, 0x19, 0xD3, 0x41, 0x23, 0x9A, 0x6C, 0x02, 0x23, 0xBE, 0x4B, 0xBB,
+	0x13, 0x0A, 0xD3, 0x41, 0xA2, 0x23, 0xF5, 0x55, 0x00, 0xEE, 0x65, 0x00, 0x60, 0x00, 0xA2, 0x17,
+	0xF0, 0x55, 0x13, 0x04, 0xA2, 0x1D, 0xF5, 0x65, 0x35, 0x0F, 0x13, 0x44, 0xA4, 0x1A, 0xD3, 0x45,
+	0x32, 0x00, 0x13, 0x32, 0xC1, 0x03, 0xA2, 0x19, 0xF1, 0x1E, 0xF0, 0x65, 0x81, 0x00, 0xC2, 0x0F,
+	0x72, 0x01, 0x23, 0x9A, 0xA4, 0x1A, 0x6C, 0x03, 0x72, 0xFF, 0x6F, 0x00, 0xD3, 0x45, 0xA2, 0x1D,
+	0xF5, 0x55, 0x00, 0xEE, 0xC4, 0x07, 0xA4, 0x1F, 0xF4, 0x1E, 0xF0, 0x65, 0x83, 0x00, 0xA4, 0x27,
+	0xF4, 0x1E, 0xF0, 0x65, 0x84, 0x00, 0xA4, 0x1A, 0xD3, 0x45, 0x60, 0x20, 0xF0, 0x18, 0x65, 0x0F,
+	0x13, 0x3E, 0x65, 0x00, 0x13, 0x3E, 0x4C, 0x01, 0x12, 0x02, 0x4C, 0x02, 0x13, 0x82, 0xA2, 0x23,
+	0xF5, 0x65, 0x45, 0x00, 0x12, 0x02, 0xA4, 0x19, 0xD3, 0x41, 0x6F, 0x00, 0xD3, 0x41, 0x3F, 0x01,
+	0x12, 0x02, 0x7E, 0x0A, 0x60, 0x40, 0xF0, 0x18, 0x00, 0xE0, 0x12, 0x4A, 0x00, 0xE0, 0x23, 0xD4,
+	0x60, 0x60, 0xF0, 0x18, 0x13, 0x94, 0x6E, 0x00, 0x13, 0x84, 0x41, 0x01, 0x74, 0xFF, 0x41, 0x04,
+	0x73, 0xFF, 0x41, 0x06, 0x73, 0x01, 0x41, 0x09, 0x74, 0x01, 0x00, 0xEE, 0x44, 0x00, 0x74, 0x01,
+	0x43, 0x00, 0x73, 0x01, 0x43, 0x38, 0x73, 0xFF, 0x44, 0x18, 0x74, 0xFF, 0x00, 0xEE, 0x6B, 0x00,
+	0x44, 0x00, 0x13, 0xCE, 0x43, 0x00, 0x13, 0xCE, 0x43, 0x3F, 0x13, 0xCE, 0x44, 0x1F, 0x6B, 0xBB,
+	0x6F, 0x00, 0x00, 0xEE, 0x63, 0x08, 0x64, 0x08, 0xA2, 0x29, 0xFE, 0x33, 0xF2, 0x65, 0x23, 0xEC,
+	0x63, 0x28, 0xA2, 0x29, 0xF6, 0x33, 0xF2, 0x65, 0x23, 0xF2, 0x00, 0xEE, 0xF0, 0x29, 0xD3, 0x45,
+	0x73, 0x06, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x06, 0xF2, 0x29, 0xD3, 0x45, 0x00, 0xEE, 0x01, 0x10,
+	0x54, 0x7C, 0x6C, 0x7C, 0x7C, 0x44, 0x7C, 0x7C, 0x6C, 0x7C, 0x54, 0x10, 0x00, 0xFC, 0x78, 0x6E,
+	0x78, 0xFC, 0x00, 0x3F, 0x1E, 0x76, 0x1E, 0x3F, 0x00, 0x80, 0xA8, 0x70, 0xF8, 0x70, 0xA8, 0x0B,
+	0x1B, 0x28, 0x38, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1B, 0x1B, 0x1B, 0x18, 0x04
+};
+
+static constexpr unsigned char rom_TETRIS[] = {
+	0xA2, 0xB4, 0x23, 0xE6, 0x22, 0xB6, 0x70, 0x01, 0xD0, 0x11, 0x30, 0x25, 0x12, 0x06, 0x71, 0xFF,
+	0xD0, 0x11, 0x60, 0x1A, 0xD0, 0x11, 0x60, 0x25, 0x31, 0x00, 0x12, 0x0E, 0xC4, 0x70, 0x44, 0x70,
+	0x12, 0x1C, 0xC3, 0x03, 0x60, 0x1E, 0x61, 0x03, 0x22, 0x5C, 0xF5, 0x15, 0xD0, 0x14, 0x3F, 0x01,
+	0x12, 0x3C, 0xD0, 0x14, 0x71, 0xFF, 0xD0, 0x14, 0x23, 0x40, 0x12, 0x1C, 0xE7, 0xA1, 0x22, 0x72,
+	0xE8, 0xA1, 0x22, 0x84, 0xE9, 0xA1, 0x22, 0x96, 0xE2, 0x9E, 0x12, 0x50, 0x66, 0x00, 0xF6, 0x15,
+	0xF6, 0x07, 0x36, 0x00, 0x12, 0x3C, 0xD0, 0x14, 0x71, 0x01, 0x12, 0x2A, 0xA2, 0xC4, 0xF4, 0x1E,
+	0x66, 0x00, 0x43, 0x01, 0x66, 0x04, 0x43, 0x02, 0x66, 0x08, 0x43, 0x03, 0x66, 0x0C, 0xF6, 0x1E,
+	0x00, 0xEE, 0xD0, 0x14, 0x70, 0xFF, 0x23, 0x34, 0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14, 0x70, 0x01,
+	0x23, 0x34, 0x00, 0xEE, 0xD0, 0x14, 0x70, 0x01, 0x23, 0x34, 0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14,
+	0x70, 0xFF, 0x23, 0x34, 0x00, 0xEE, 0xD0, 0x14, 0x73, 0x01, 0x43, 0x04, 0x63, 0x00, 0x22, 0x5C,
+	0x23, 0x34, 0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14, 0x73, 0xFF, 0x43, 0xFF, 0x63, 0x03, 0x22, 0x5C,
+	0x23, 0x34, 0x00, 0xEE, 0x80, 0x00, 0x67, 0x05, 0x68, 0x06, 0x69, 0x04, 0x61, 0x1F, 0x65, 0x10,
+	0x62, 0x07, 0x00, 0xEE, 0x40, 0xE0, 0x00, 0x00, 0x40, 0xC0, 0x40, 0x00, 0x00, 0xE0, 0x40, 0x00,
+	0x40, 0x60, 0x40, 0x00, 0x40, 0x40, 0x60, 0x00, 0x20, 0xE0, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x00,
+	0x00, 0xE0, 0x80, 0x00, 0x40, 0x40, 0xC0, 0x00, 0x00, 0xE0, 0x20, 0x00, 0x60, 0x40, 0x40, 0x00,
+	0x80, 0xE0, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00,
+	0xC0, 0x60, 0x00, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x80, 0xC0, 0x40, 0x00,
+	0x00, 0x60, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0xC0, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+	0x00, 0xF0, 0x00, 0x00, 0xD0, 0x14, 0x66, 0x35, 0x76, 0xFF, 0x36, 0x00, 0x13, 0x38, 0x00, 0xEE,
+	0xA2, 0xB4, 0x8C, 0x10, 0x3C, 0x1E, 0x7C, 0x01, 0x3C, 0x1E, 0x7C, 0x01, 0x3C, 0x1E, 0x7C, 0x01,
+	0x23, 0x5E, 0x4B, 0x0A, 0x23, 0x72, 0x91, 0xC0, 0x00, 0xEE, 0x71, 0x01, 0x13, 0x50, 0x60, 0x1B,
+	0x6B, 0x00, 0xD0, 0x11, 0x3F, 0x00, 0x7B, 0x01, 0xD0, 0x11, 0x70, 0x01, 0x30, 0x25, 0x13, 0x62,
+	0x00, 0xEE, 0x60, 0x1B, 0xD0, 0x11, 0x70, 0x01, 0x30, 0x25, 0x13, 0x74, 0x8E, 0x10, 0x8D, 0xE0,
+	0x7E, 0xFF, 0x60, 0x1B, 0x6B, 0x00, 0xD0, 0xE1, 0x3F, 0x00, 0x13, 0x90, 0xD0, 0xE1, 0x13, 0x94,
+	0xD0, 0xD1, 0x7B, 0x01, 0x70, 0x01, 0x30, 0x25, 0x13, 0x86, 0x4B, 0x00, 0x13, 0xA6, 0x7D, 0xFF,
+	0x7E, 0xFF, 0x3D, 0x01, 0x13, 0x82, 0x23, 0xC0, 0x3F, 0x01, 0x23, 0xC0, 0x7A, 0x01, 0x23, 0xC0,
+	0x80, 0xA0, 0x6D, 0x07, 0x80, 0xD2, 0x40, 0x04, 0x75, 0xFE, 0x45, 0x02, 0x65, 0x04, 0x00, 0xEE,
+	0xA7, 0x00, 0xF2, 0x55, 0xA8, 0x04, 0xFA, 0x33, 0xF2, 0x65, 0xF0, 0x29, 0x6D, 0x32, 0x6E, 0x00,
+	0xDD, 0xE5, 0x7D, 0x05, 0xF1, 0x29, 0xDD, 0xE5, 0x7D, 0x05, 0xF2, 0x29, 0xDD, 0xE5, 0xA7, 0x00,
+	0xF2, 0x65, 0xA2, 0xB4, 0x00, 0xEE, 0x6A, 0x00, 0x60, 0x19, 0x00, 0xEE, 0x37, 0x23
+};
+
+static constexpr unsigned char rom_TICTAC[] = {
+	0x12, 0x18, 0x54, 0x49, 0x43, 0x54, 0x41, 0x43, 0x20, 0x62, 0x79, 0x20, 0x44, 0x61, 0x76, 0x69,
+	0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0x6B, 0x00, 0x6C, 0x00, 0x80, 0xB0, 0x81, 0xC0,
+	0xA3, 0xE6, 0xF1, 0x55, 0xA3, 0xC4, 0xFF, 0x65, 0xA3, 0xB4, 0xFF, 0x55, 0xA3, 0xE6, 0xF1, 0x65,
+	0x8B, 0x00, 0x8C, 0x10, 0x00, 0xE0, 0x6E, 0x01, 0x60, 0x13, 0x61, 0x03, 0xA3, 0x9A, 0xD0, 0x11,
+	0x70, 0x08, 0x30, 0x2B, 0x12, 0x3E, 0x60, 0x13, 0x71, 0x08, 0x31, 0x23, 0x12, 0x3E, 0x60, 0x13,
+	0x61, 0x03, 0xA3, 0x9B, 0xD0, 0x1F, 0x70, 0x08, 0x30, 0x33, 0x12, 0x54, 0x60, 0x13, 0x71, 0x0F,
+	0xD0, 0x1A, 0x70, 0x08, 0x30, 0x33, 0x12, 0x60, 0x23, 0x66, 0xF0, 0x0A, 0x81, 0x00, 0xA3, 0xB4,
+	0xF0, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x12, 0x8A, 0x22, 0x7C, 0x12, 0x6A, 0x60, 0x10, 0xF0, 0x18,
+	0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x82, 0x00, 0xEE, 0x60, 0x02, 0x8E, 0x03, 0x80, 0xE0,
+	0xF0, 0x55, 0xA3, 0xD4, 0x80, 0x10, 0x70, 0xFF, 0x80, 0x04, 0xF0, 0x1E, 0xF1, 0x65, 0xA3, 0xAA,
+	0x3E, 0x03, 0xA3, 0xAF, 0xD0, 0x15, 0x22, 0xC8, 0x3A, 0x00, 0x12, 0x1C, 0xA3, 0xB4, 0x61, 0x00,
+	0x62, 0x00, 0x63, 0x01, 0xF0, 0x65, 0x30, 0x00, 0x71, 0x01, 0xF3, 0x1E, 0x72, 0x01, 0x32, 0x10,
+	0x12, 0xB4, 0x31, 0x10, 0x12, 0x6A, 0x12, 0x1C, 0x6A, 0x00, 0xA3, 0xB4, 0x60, 0x01, 0xF0, 0x1E,
+	0xF8, 0x65, 0x69, 0x00, 0x89, 0x04, 0x23, 0x44, 0x89, 0x14, 0x23, 0x44, 0x89, 0x24, 0x23, 0x4A,
+	0x69, 0x00, 0x89, 0x34, 0x23, 0x44, 0x89, 0x44, 0x23, 0x44, 0x89, 0x54, 0x23, 0x4A, 0x69, 0x00,
+	0x89, 0x64, 0x23, 0x44, 0x89, 0x74, 0x23, 0x44, 0x89, 0x84, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x64,
+	0x23, 0x44, 0x89, 0x34, 0x23, 0x44, 0x89, 0x04, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x74, 0x23, 0x44,
+	0x89, 0x44, 0x23, 0x44, 0x89, 0x14, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x84, 0x23, 0x44, 0x89, 0x54,
+	0x23, 0x44, 0x89, 0x24, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x84, 0x23, 0x44, 0x89, 0x44, 0x23, 0x44,
+	0x89, 0x04, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x64, 0x23, 0x44, 0x89, 0x44, 0x23, 0x44, 0x89, 0x24,
+	0x23, 0x4A, 0x00, 0xEE, 0x89, 0x0E, 0x89, 0x0E, 0x00, 0xEE, 0x49, 0x15, 0x13, 0x54, 0x49, 0x3F,
+	0x13, 0x5A, 0x00, 0xEE, 0x23, 0x66, 0x7B, 0x01, 0x13, 0x5E, 0x23, 0x66, 0x7C, 0x01, 0x23, 0x66,
+	0x6A, 0x01, 0xF0, 0x0A, 0x00, 0xEE, 0x63, 0x05, 0x64, 0x0A, 0xA3, 0xAF, 0xD3, 0x45, 0x63, 0x02,
+	0x74, 0x06, 0xA3, 0xE6, 0xFB, 0x33, 0x23, 0x88, 0x63, 0x32, 0x64, 0x0A, 0xA3, 0xAA, 0xD3, 0x45,
+	0x63, 0x2F, 0x74, 0x06, 0xA3, 0xE6, 0xFC, 0x33, 0xF2, 0x65, 0xF0, 0x29, 0x23, 0x94, 0xF1, 0x29,
+	0x23, 0x94, 0xF2, 0x29, 0xD3, 0x45, 0x73, 0x05, 0x00, 0xEE, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x22,
+	0x14, 0x08, 0x14, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x13, 0x05, 0x1B, 0x05, 0x23, 0x05, 0x13, 0x0D, 0x1B, 0x0D, 0x23, 0x0D,
+	0x13, 0x15, 0x1B, 0x15, 0x23, 0x15
+};
+
+static constexpr unsigned char rom_UFO[] = {
+	0xA2, 0xCD, 0x69, 0x38, 0x6A, 0x08, 0xD9, 0xA3, 0xA2, 0xD0, 0x6B, 0x00, 0x6C, 0x03, 0xDB, 0xC3,
+	0xA2, 0xD6, 0x64, 0x1D, 0x65, 0x1F, 0xD4, 0x51, 0x67, 0x00, 0x68, 0x0F, 0x22, 0xA2, 0x22, 0xAC,
+	0x48, 0x00, 0x12, 0x22, 0x64, 0x1E, 0x65, 0x1C, 0xA2, 0xD3, 0xD4, 0x53, 0x6E, 0x00, 0x66, 0x80,
+	0x6D, 0x04, 0xED, 0xA1, 0x66, 0xFF, 0x6D, 0x05, 0xED, 0xA1, 0x66, 0x00, 0x6D, 0x06, 0xED, 0xA1,
+	0x66, 0x01, 0x36, 0x80, 0x22, 0xD8, 0xA2, 0xD0, 0xDB, 0xC3, 0xCD, 0x01, 0x8B, 0xD4, 0xDB, 0xC3,
+	0x3F, 0x00, 0x12, 0x92, 0xA2, 0xCD, 0xD9, 0xA3, 0xCD, 0x01, 0x3D, 0x00, 0x6D, 0xFF, 0x79, 0xFE,
+	0xD9, 0xA3, 0x3F, 0x00, 0x12, 0x8C, 0x4E, 0x00, 0x12, 0x2E, 0xA2, 0xD3, 0xD4, 0x53, 0x45, 0x00,
+	0x12, 0x86, 0x75, 0xFF, 0x84, 0x64, 0xD4, 0x53, 0x3F, 0x01, 0x12, 0x46, 0x6D, 0x08, 0x8D, 0x52,
+	0x4D, 0x08, 0x12, 0x8C, 0x12, 0x92, 0x22, 0xAC, 0x78, 0xFF, 0x12, 0x1E, 0x22, 0xA2, 0x77, 0x05,
+	0x12, 0x96, 0x22, 0xA2, 0x77, 0x0F, 0x22, 0xA2, 0x6D, 0x03, 0xFD, 0x18, 0xA2, 0xD3, 0xD4, 0x53,
+	0x12, 0x86, 0xA2, 0xF8, 0xF7, 0x33, 0x63, 0x00, 0x22, 0xB6, 0x00, 0xEE, 0xA2, 0xF8, 0xF8, 0x33,
+	0x63, 0x32, 0x22, 0xB6, 0x00, 0xEE, 0x6D, 0x1B, 0xF2, 0x65, 0xF0, 0x29, 0xD3, 0xD5, 0x73, 0x05,
+	0xF1, 0x29, 0xD3, 0xD5, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0xD5, 0x00, 0xEE, 0x01, 0x7C, 0xFE, 0x7C,
+	0x60, 0xF0, 0x60, 0x40, 0xE0, 0xA0, 0xF8, 0xD4, 0x6E, 0x01, 0x6D, 0x10, 0xFD, 0x18, 0x00, 0xEE
+};
+
+static constexpr unsigned char rom_VERS[] = {
+	0x12, 0x1A, 0x4A, 0x4D, 0x4E, 0x20, 0x31, 0x39, 0x39, 0x31, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57,
+	0x41, 0x52, 0x45, 0x53, 0x20, 0x80, 0x80, 0xFF, 0x00, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00, 0xE0,
+	0xA2, 0x17, 0x60, 0x00, 0x61, 0x00, 0xD0, 0x11, 0x71, 0xFF, 0xD0, 0x11, 0x71, 0x01, 0x70, 0x08,
+	0x30, 0x40, 0x12, 0x26, 0x71, 0x01, 0xA2, 0x15, 0xD0, 0x12, 0x70, 0xFF, 0xD0, 0x12, 0x70, 0x01,
+	0x71, 0x02, 0x31, 0x1F, 0x12, 0x38, 0x60, 0x08, 0x61, 0x10, 0x62, 0x04, 0x64, 0x37, 0x65, 0x0F,
+	0x66, 0x02, 0xD0, 0x11, 0xD4, 0x51, 0x68, 0x01, 0xE8, 0xA1, 0x62, 0x02, 0x68, 0x02, 0xE8, 0xA1,
+	0x62, 0x04, 0x68, 0x07, 0xE8, 0xA1, 0x62, 0x01, 0x68, 0x0A, 0xE8, 0xA1, 0x62, 0x03, 0x68, 0x0B,
+	0xE8, 0xA1, 0x66, 0x02, 0x68, 0x0F, 0xE8, 0xA1, 0x66, 0x04, 0x68, 0x0C, 0xE8, 0xA1, 0x66, 0x01,
+	0x68, 0x0D, 0xE8, 0xA1, 0x66, 0x03, 0x42, 0x01, 0x71, 0xFF, 0x42, 0x02, 0x70, 0xFF, 0x42, 0x03,
+	0x71, 0x01, 0x42, 0x04, 0x70, 0x01, 0x46, 0x01, 0x75, 0xFF, 0x46, 0x02, 0x74, 0xFF, 0x46, 0x03,
+	0x75, 0x01, 0x46, 0x04, 0x74, 0x01, 0xD0, 0x11, 0x3F, 0x00, 0x12, 0xB4, 0xD4, 0x51, 0x3F, 0x00,
+	0x12, 0xB8, 0x12, 0x56, 0x77, 0x01, 0x12, 0xBA, 0x73, 0x01, 0x68, 0x00, 0x78, 0x01, 0x38, 0x00,
+	0x12, 0xBC, 0x00, 0xE0, 0x60, 0x08, 0x61, 0x04, 0xF3, 0x29, 0xD0, 0x15, 0x60, 0x34, 0xF7, 0x29,
+	0xD0, 0x15, 0x68, 0x00, 0x78, 0x01, 0x38, 0x00, 0x12, 0xD4, 0x43, 0x08, 0x12, 0xE4, 0x47, 0x08,
+	0x12, 0xE4, 0x12, 0x1E, 0x12, 0xE4
+};
+
+static constexpr unsigned char rom_WIPEOFF[] = {
+	0xA2, 0xCC, 0x6A, 0x07, 0x61, 0x00, 0x6B, 0x08, 0x60, 0x00, 0xD0, 0x11, 0x70, 0x08, 0x7B, 0xFF,
+	0x3B, 0x00, 0x12, 0x0A, 0x71, 0x04, 0x7A, 0xFF, 0x3A, 0x00, 0x12, 0x06, 0x66, 0x00, 0x67, 0x10,
+	0xA2, 0xCD, 0x60, 0x20, 0x61, 0x1E, 0xD0, 0x11, 0x63, 0x1D, 0x62, 0x3F, 0x82, 0x02, 0x77, 0xFF,
+	0x47, 0x00, 0x12, 0xAA, 0xFF, 0x0A, 0xA2, 0xCB, 0xD2, 0x31, 0x65, 0xFF, 0xC4, 0x01, 0x34, 0x01,
+	0x64, 0xFF, 0xA2, 0xCD, 0x6C, 0x00, 0x6E, 0x04, 0xEE, 0xA1, 0x6C, 0xFF, 0x6E, 0x06, 0xEE, 0xA1,
+	0x6C, 0x01, 0xD0, 0x11, 0x80, 0xC4, 0xD0, 0x11, 0x4F, 0x01, 0x12, 0x98, 0x42, 0x00, 0x64, 0x01,
+	0x42, 0x3F, 0x64, 0xFF, 0x43, 0x00, 0x65, 0x01, 0x43, 0x1F, 0x12, 0xA4, 0xA2, 0xCB, 0xD2, 0x31,
+	0x82, 0x44, 0x83, 0x54, 0xD2, 0x31, 0x3F, 0x01, 0x12, 0x42, 0x43, 0x1E, 0x12, 0x98, 0x6A, 0x02,
+	0xFA, 0x18, 0x76, 0x01, 0x46, 0x70, 0x12, 0xAA, 0xD2, 0x31, 0xC4, 0x01, 0x34, 0x01, 0x64, 0xFF,
+	0xC5, 0x01, 0x35, 0x01, 0x65, 0xFF, 0x12, 0x42, 0x6A, 0x03, 0xFA, 0x18, 0xA2, 0xCB, 0xD2, 0x31,
+	0x73, 0xFF, 0x12, 0x36, 0xA2, 0xCB, 0xD2, 0x31, 0x12, 0x28, 0xA2, 0xCD, 0xD0, 0x11, 0xA2, 0xF0,
+	0xF6, 0x33, 0xF2, 0x65, 0x63, 0x18, 0x64, 0x1B, 0xF0, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF1, 0x29,
+	0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x12, 0xC8, 0x01, 0x80, 0x44, 0xFF
+};
+
+const bundledRom bundledRoms[] = {
+	{ "15PUZZLE", rom_15PUZZLE, sizeof(rom_15PUZZLE), 0xE59FD57FA44ECB40ull },
+	{ "BLINKY", rom_BLINKY, sizeof(rom_BLINKY), 0x0FD332D0BC68C9F2ull },
+	{ "BRIX", rom_BRIX, sizeof(rom_BRIX), 0xC86E8FF63FCE668Cull },
+	{ "CONNECT4", rom_CONNECT4, sizeof(rom_CONNECT4), 0xADF99268DB3C3BC9ull },
+	{ "GUESS", rom_GUESS, sizeof(rom_GUESS), 0x1BBB10C8E5CADBB5ull },
+	{ "HIDDEN", rom_HIDDEN, sizeof(rom_HIDDEN), 0x3F58EB4FA83DCD98ull },
+	{ "INVADERS", rom_INVADERS, sizeof(rom_INVADERS), 0x8E547EBB12C026B4ull },
+	{ "KALEID", rom_KALEID, sizeof(rom_KALEID), 0xA8E9391EBB18DF6Full },
+	{ "MAZE", rom_MAZE, sizeof(rom_MAZE), 0x25E96E1086CE43CBull },
+	{ "MERLIN", rom_MERLIN, sizeof(rom_MERLIN), 0x43DEF5533F6D8D25ull },
+	{ "MISSILE", rom_MISSILE, sizeof(rom_MISSILE), 0x71CDB8B926F1B988ull },
+	{ "PONG", rom_PONG, sizeof(rom_PONG), 0x624B3EED64313F42ull },
+	{ "PONG2", rom_PONG2, sizeof(rom_PONG2), 0x0F81C6A74DCD366Eull },
+	{ "PUZZLE", rom_PUZZLE, sizeof(rom_PUZZLE), 0x36F264B8F72349A6ull },
+	{ "TANK", rom_TANK, sizeof(rom_TANK), 0x3E2C2D43B296B74Cull },
+	{ "TETRIS", rom_TETRIS, sizeof(rom_TETRIS), 0x04EB2109DC29B1ABull },
+	{ "TICTAC", rom_TICTAC, sizeof(rom_TICTAC), 0x56049E83866B207Dull },
+	{ "UFO", rom_UFO, sizeof(rom_UFO), 0x8D8A02FA3A2ED293ull },
+	{ "VERS", rom_VERS, sizeof(rom_VERS), 0xEAE1357F230D90C5ull },
+	{ "WIPEOFF", rom_WIPEOFF, sizeof(rom_WIPEOFF), 0xB7E1D74B387BEDE6ull },
+};
+
+const size_t bundledRomCount = sizeof(bundledRoms) / sizeof(bundledRoms[0]);
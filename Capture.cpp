@@ -0,0 +1,271 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <cstring>
+#include "Capture.h"
+
+using namespace std;
+
+static const char captureMagic[8] = { 'C', 'H', 'I', 'P', '8', 'C', 'A', 'P' };
+static const unsigned char captureVersion = 1;
+
+
+int capturedFrame::pixelColor(int x, int y) const {
+	int color = 0;
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (rowPixel(rows[plane][y], x)) {
+			color |= 1 << plane;
+		}
+	}
+
+	return color;
+}
+
+
+static void putVarint(vector<unsigned char>& out, unsigned long long value) {
+	while (value >= 0x80) {
+		out.push_back((unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((unsigned char)value);
+}
+
+
+static bool getVarint(ifstream& in, unsigned long long& value) {
+	value = 0;
+
+	for (int shift = 0; shift < 64; shift += 7) {
+		int byte = in.get();
+		if (byte == EOF) {
+			return false;
+		}
+
+		value |= (unsigned long long)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+frameCapture::frameCapture(const string& path, size_t bufferedFrames) : queue(bufferedFrames) {
+	file.open(path, ios::out | ios::binary | ios::trunc);
+	if (!file) {
+		return;
+	}
+
+	file.write(captureMagic, 8);
+	file.put((char)captureVersion);
+	file.put((char)DISPLAY_PLANES);
+
+	writer = thread(&frameCapture::writeFrames, this);
+}
+
+
+frameCapture::~frameCapture() {
+	if (writer.joinable()) {
+		{
+			lock_guard<mutex> guard(queueLock);
+			stopping = true;
+		}
+		queueChanged.notify_all();
+		writer.join();
+	}
+}
+
+
+bool frameCapture::isOpen() const {
+	return file.is_open();
+}
+
+
+void frameCapture::frame(const chip8& machine, unsigned long long cycle) {
+	if (!writer.joinable()) {
+		return;
+	}
+
+	unique_lock<mutex> guard(queueLock);
+
+	if (queueCount == queue.size()) {
+		stalls++;
+		queueChanged.wait(guard, [&] { return queueCount < queue.size(); });
+	}
+
+	//The writer never touches a slot until it is counted, so the copy can happen outside the lock
+	capturedFrame& slot = queue[(queueHead + queueCount) % queue.size()];
+	guard.unlock();
+
+	slot.cycle = cycle;
+	slot.hires = machine.displayWidth() == 128;
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		memcpy(slot.rows[plane], machine.displayRows(plane), sizeof(slot.rows[plane]));
+	}
+
+	guard.lock();
+	queueCount++;
+	guard.unlock();
+	queueChanged.notify_all();
+}
+
+
+unsigned long long frameCapture::stalled() const {
+	return stalls;
+}
+
+
+void frameCapture::writeFrames() {
+	while (true) {
+		unique_lock<mutex> guard(queueLock);
+		queueChanged.wait(guard, [&] { return queueCount > 0 || stopping; });
+
+		if (queueCount == 0) {
+			return; //Stopping and everything is written
+		}
+
+		//The frame stays counted while it is encoded, so frame() cannot reuse its slot
+		const capturedFrame& current = queue[queueHead];
+		guard.unlock();
+
+		encode(current);
+		file.write((const char*)record.data(), record.size());
+
+		guard.lock();
+		queueHead = (queueHead + 1) % queue.size();
+		queueCount--;
+		guard.unlock();
+		queueChanged.notify_all();
+	}
+}
+
+
+void frameCapture::encode(const capturedFrame& current) {
+	record.clear();
+	putVarint(record, current.cycle - previous.cycle);
+
+	size_t flagsAt = record.size();
+	unsigned char flags = current.hires ? 0x80 : 0;
+	record.push_back(0);
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		unsigned long long changedRows = 0;
+		for (int row = 0; row < 64; row++) {
+			if (!rowIsEmpty(rowXor(current.rows[plane][row], previous.rows[plane][row]))) {
+				changedRows |= 1ull << row;
+			}
+		}
+
+		if (changedRows == 0) {
+			continue;
+		}
+
+		flags |= 1 << plane;
+		putVarint(record, changedRows);
+
+		for (int row = 0; row < 64; row++) {
+			if ((changedRows & (1ull << row)) == 0) {
+				continue;
+			}
+
+			displayRow delta = rowXor(current.rows[plane][row], previous.rows[plane][row]);
+
+			unsigned short byteMask = 0;
+			for (int i = 0; i < 16; i++) {
+				if (rowByte(delta, i) != 0) {
+					byteMask |= 1 << i;
+				}
+			}
+
+			record.push_back((unsigned char)(byteMask & 0xFF));
+			record.push_back((unsigned char)(byteMask >> 8));
+			for (int i = 0; i < 16; i++) {
+				if (byteMask & (1 << i)) {
+					record.push_back(rowByte(delta, i));
+				}
+			}
+		}
+	}
+
+	record[flagsAt] = flags;
+	previous = current;
+}
+
+
+frameReader::frameReader(const string& path) {
+	file.open(path, ios::in | ios::binary);
+
+	char magic[8];
+	if (!file.read(magic, 8) || memcmp(magic, captureMagic, 8) != 0 || file.get() != captureVersion) {
+		file.close();
+		return;
+	}
+
+	planes = file.get();
+	if (planes < 1 || planes > DISPLAY_PLANES) {
+		file.close();
+	}
+}
+
+
+bool frameReader::isOpen() const {
+	return file.is_open();
+}
+
+
+bool frameReader::next(capturedFrame& frame) {
+	if (!file.is_open()) {
+		return false;
+	}
+
+	unsigned long long cycles;
+	int flags;
+	if (!getVarint(file, cycles) || (flags = file.get()) == EOF) {
+		return false;
+	}
+
+	current.cycle += cycles;
+	current.hires = (flags & 0x80) != 0;
+
+	for (int plane = 0; plane < planes; plane++) {
+		if ((flags & (1 << plane)) == 0) {
+			continue;
+		}
+
+		unsigned long long changedRows;
+		if (!getVarint(file, changedRows)) {
+			return false;
+		}
+
+		for (int row = 0; row < 64; row++) {
+			if ((changedRows & (1ull << row)) == 0) {
+				continue;
+			}
+
+			int low = file.get();
+			int high = file.get();
+			if (high == EOF) {
+				return false;
+			}
+
+			unsigned short byteMask = (unsigned short)(low | (high << 8));
+			for (int i = 0; i < 16; i++) {
+				if (byteMask & (1 << i)) {
+					int value = file.get();
+					if (value == EOF) {
+						return false;
+					}
+					current.rows[plane][row] = rowXor(current.rows[plane][row], byteRow((unsigned char)value, i));
+				}
+			}
+		}
+	}
+
+	frame = current;
+	return true;
+}
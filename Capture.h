@@ -0,0 +1,96 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Frame capture. frameCapture::frame() copies the packed display planes in to a bounded queue, and a writer thread encodes and
+writes them, so the emulation thread never waits on the disk (unless the queue fills up).
+
+File format, all integers little-endian:
+	"CHIP8CAP", version (1 byte), plane count (1 byte)
+	then one record per frame:
+		cycle stamp        varint, cycles since the previous frame's stamp
+		flags              1 byte: bit p set if plane p changed, bit 7 set for the 128 x 64 screen
+		for each changed plane:
+			changed rows   varint, bit r set if row r differs from the previous frame
+			for each changed row, top to bottom:
+				byte mask  2 bytes, bit i set if byte i of the row XOR is not zero
+				bytes      the non-zero bytes of (new row XOR previous row), pixels 8i to 8i + 7 in byte i, MSB first
+An unchanged frame takes 2-4 bytes, so an hour of 60 fps capture is usually well under a megabyte plus whatever moves.
+********************************************************************************************************************************/
+
+//One frame as captured: every plane of the display with the cycle count it was taken at
+struct capturedFrame {
+	unsigned long long cycle = 0;
+	bool hires = false;
+	displayRow rows[DISPLAY_PLANES][64] = { };
+
+	int width() const { return hires ? 128 : 64; }
+
+	int height() const { return hires ? 64 : 32; }
+
+	int pixelColor(int x, int y) const; //Bit p set if the pixel is lit in plane p
+};
+
+//Writes a capture file on a background thread
+class frameCapture {
+	ofstream file;
+
+	//Frames waiting for the writer. The emulation thread only blocks when all of them are full.
+	vector<capturedFrame> queue;
+	size_t queueHead = 0; //Next frame to write
+	size_t queueCount = 0;
+	mutex queueLock;
+	condition_variable queueChanged;
+	bool stopping = false;
+	unsigned long long stalls = 0; //Frames the emulation thread had to wait for space
+
+	thread writer;
+
+	capturedFrame previous; //Last frame written, the reference for the row deltas
+	vector<unsigned char> record; //Encoded frame
+
+	void writeFrames(); //Writer thread
+
+	void encode(const capturedFrame& current);
+
+public:
+	frameCapture(const string& path, size_t bufferedFrames = 120);
+
+	~frameCapture(); //Writes out the frames still queued and closes the file
+
+	bool isOpen() const; //False if the file could not be created
+
+	void frame(const chip8& machine, unsigned long long cycle); //Queue the machine's display, stamped with cycle
+
+	unsigned long long stalled() const; //Frames that had to wait for the writer
+};
+
+//Reads a capture file back one frame at a time
+class frameReader {
+	ifstream file;
+	capturedFrame current;
+	int planes = 0;
+
+public:
+	explicit frameReader(const string& path);
+
+	bool isOpen() const; //False if the file is missing or not a capture
+
+	bool next(capturedFrame& frame); //Decode the next frame. False at the end of the file.
+};
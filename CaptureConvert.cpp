@@ -0,0 +1,197 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Converts a frame capture (Capture.h) to a numbered sequence of images.
+
+Usage: CaptureConvert <capture> <output prefix> [ppm|png] [scale] [first frame] [last frame]
+
+Frames are written as <prefix>000001.ppm (or .png) and so on, counted from 1, with each CHIP-8 pixel scaled to scale x scale
+image pixels (default 10). The colours are the emulator's palette. PNGs are written uncompressed so the tool needs no
+libraries; they compress well with any PNG optimizer if size matters.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include "Capture.h"
+#include "Expand.h"
+
+using namespace std;
+
+
+//Frame as 8-bit RGB, scale x scale image pixels per CHIP-8 pixel. rgba is scratch space kept between frames.
+void renderFrame(const capturedFrame& frame, int scale, vector<unsigned char>& rgba, vector<unsigned char>& rgb) {
+	static const expandPalette palette = defaultPalette();
+	size_t pixels = (size_t)frame.width() * scale * frame.height() * scale;
+	rgba.resize(pixels * 4);
+	rgb.resize(pixels * 3);
+
+	framebufferView view;
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		view.planes[plane] = frame.rows[plane];
+	}
+	view.width = frame.width();
+	view.height = frame.height();
+	expandRgba(view, scale, palette, rgba.data(), (size_t)frame.width() * scale * 4);
+
+	for (size_t i = 0; i < pixels; i++) {
+		memcpy(&rgb[i * 3], &rgba[i * 4], 3);
+	}
+}
+
+
+bool writePpm(const string& path, int width, int height, const vector<unsigned char>& rgb) {
+	ofstream out(path, ios::out | ios::binary);
+	out << "P6\n" << width << " " << height << "\n255\n";
+	out.write((const char*)rgb.data(), rgb.size());
+	return out.good();
+}
+
+
+unsigned crc32(const unsigned char* data, size_t size, unsigned crc = 0) {
+	static unsigned table[256];
+	static bool tableReady = false;
+
+	if (!tableReady) {
+		for (unsigned n = 0; n < 256; n++) {
+			unsigned c = n;
+			for (int k = 0; k < 8; k++) {
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[n] = c;
+		}
+		tableReady = true;
+	}
+
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++) {
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+
+void putBigEndian(vector<unsigned char>& out, unsigned value) {
+	for (int shift = 24; shift >= 0; shift -= 8) {
+		out.push_back((unsigned char)(value >> shift));
+	}
+}
+
+
+void writeChunk(ofstream& out, const char* type, const vector<unsigned char>& data) {
+	vector<unsigned char> chunk;
+	putBigEndian(chunk, (unsigned)data.size());
+	chunk.insert(chunk.end(), type, type + 4);
+	chunk.insert(chunk.end(), data.begin(), data.end());
+	putBigEndian(chunk, crc32(chunk.data() + 4, chunk.size() - 4));
+	out.write((const char*)chunk.data(), chunk.size());
+}
+
+
+//PNG with the image data in stored (uncompressed) deflate blocks
+bool writePng(const string& path, int width, int height, const vector<unsigned char>& rgb) {
+	ofstream out(path, ios::out | ios::binary);
+	const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	out.write((const char*)signature, 8);
+
+	vector<unsigned char> header;
+	putBigEndian(header, width);
+	putBigEndian(header, height);
+	header.insert(header.end(), { 8, 2, 0, 0, 0 }); //8-bit RGB, no interlace
+	writeChunk(out, "IHDR", header);
+
+	//Every scanline starts with filter type 0
+	vector<unsigned char> raw;
+	for (int y = 0; y < height; y++) {
+		raw.push_back(0);
+		raw.insert(raw.end(), rgb.begin() + y * width * 3, rgb.begin() + (y + 1) * width * 3);
+	}
+
+	vector<unsigned char> zlib = { 0x78, 0x01 };
+	for (size_t offset = 0; offset < raw.size(); offset += 65535) {
+		size_t length = min<size_t>(65535, raw.size() - offset);
+		zlib.push_back(offset + length == raw.size() ? 1 : 0); //Final block flag
+		zlib.push_back((unsigned char)(length & 0xFF));
+		zlib.push_back((unsigned char)(length >> 8));
+		zlib.push_back((unsigned char)(~length & 0xFF));
+		zlib.push_back((unsigned char)((~length >> 8) & 0xFF));
+		zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+	}
+
+	unsigned a = 1, b = 0; //Adler-32 of the uncompressed data
+	for (unsigned char byte : raw) {
+		a = (a + byte) % 65521;
+		b = (b + a) % 65521;
+	}
+	putBigEndian(zlib, (b << 16) | a);
+	writeChunk(out, "IDAT", zlib);
+
+	writeChunk(out, "IEND", {});
+	return out.good();
+}
+
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		cout << "Usage: CaptureConvert <capture> <output prefix> [ppm|png] [scale] [first frame] [last frame]" << endl;
+		return 1;
+	}
+
+	string format = argc > 3 ? argv[3] : "ppm";
+	int scale = argc > 4 ? atoi(argv[4]) : 10;
+	long first = argc > 5 ? atol(argv[5]) : 1;
+	long last = argc > 6 ? atol(argv[6]) : -1;
+
+	if ((format != "ppm" && format != "png") || scale < 1) {
+		cout << "The format must be ppm or png and the scale at least 1" << endl;
+		return 1;
+	}
+
+	frameReader reader(argv[1]);
+	if (!reader.isOpen()) {
+		cout << "Could not read a frame capture from " << argv[1] << endl;
+		return 1;
+	}
+
+	capturedFrame frame;
+	vector<unsigned char> rgba, rgb;
+	long number = 0;
+	long written = 0;
+
+	while (reader.next(frame)) {
+		number++;
+		if (number < first) {
+			continue;
+		}
+		if (last >= 0 && number > last) {
+			break;
+		}
+
+		ostringstream path;
+		path << argv[2] << setw(6) << setfill('0') << number << "." << format;
+
+		renderFrame(frame, scale, rgba, rgb);
+		int width = frame.width() * scale;
+		int height = frame.height() * scale;
+		bool ok = format == "png" ? writePng(path.str(), width, height, rgb) : writePpm(path.str(), width, height, rgb);
+
+		if (!ok) {
+			cout << "Could not write " << path.str() << endl;
+			return 1;
+		}
+		written++;
+	}
+
+	cout << written << " frames written" << endl;
+	return 0;
+}
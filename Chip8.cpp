@@ -6,15 +6,19 @@ Date: April 6 2020
 */
 
 #include <iostream>
+#include <cstring>
 #include <iomanip>
 #include <fstream>
+#include <iterator>
+#ifndef CHIP8_HEADLESS
 #include <GL/freeglut.h>
+#endif
 #include "Chip8.h"
 
 using namespace std;
 
-//debug variables
-int cycleCount = 0;
+//debug variables (per thread, so machines can run on several threads at once)
+thread_local int cycleCount = 0;
 
 //The Font Set of Numbers 0-9 and Hex digits A-F
 const unsigned char fontSet[80] = {
@@ -36,6 +40,39 @@ const unsigned char fontSet[80] = {
 0xF0, 0x80, 0xF0, 0x80, 0x80, //F
 };
 
+//The SUPER-CHIP Font Set: 8x10 pixel digits 0-9 and A-F, used by FX30
+const unsigned char bigFontSet[160] = {
+0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, //0
+0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, //1
+0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, //2
+0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C, //3
+0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06, //4
+0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C, //5
+0x3E, 0x7C, 0xE0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C, //6
+0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60, //7
+0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C, //8
+0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C, //9
+0x3C, 0x7E, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, //A
+0xFC, 0xFE, 0xC3, 0xC3, 0xFE, 0xFE, 0xC3, 0xC3, 0xFE, 0xFC, //B
+0x3C, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x3C, //C
+0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC, //D
+0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xFF, 0xFF, //E
+0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, //F
+};
+
+
+chip8::chip8()
+{
+	random_device seed;
+	randEngine.seed(seed());
+
+	gfx.assign(DISPLAY_PLANES * 64, displayRow{ 0, 0 });
+	displayHash = 0;
+
+	setXoChip(false);
+	setQuirks(QUIRKS_DEFAULT);
+}
+
 
 void chip8::initialize()
 {
@@ -47,20 +84,24 @@ void chip8::initialize()
 	stack_pointer = 0;
 	V[0xF] = 0;
 
-	//Clear memory array
-	for (int i = 0; i < 4096; i++) {
-		memory[i] = 0;
-	}
+	//Clear memory array. A forked machine stops sharing with its parent here; its own pages are reused.
+	memory.assign(memory.size(), 0);
+	memoryHash = 0;
 
 	//Clear register array
 	for (int i = 0; i < 16; i++) {
 		V[i] = 0;
 	}
 
-	//Clear graphics array
-	for (int i = 0; i < 2048; i++) {
-		gfx[i] = 0;
+	//Clear graphics array and go back to the 64 x 32 screen with only the first plane selected
+	planeMask = 1;
+	setHires(false);
+
+	//Silence the XO-CHIP audio pattern
+	for (int i = 0; i < 16; i++) {
+		audioPattern[i] = 0;
 	}
+	audioPitch = 64;
 
 	//Clear stack array
 	for (int i = 0; i < 16; i++) {
@@ -69,36 +110,321 @@ void chip8::initialize()
 
 	//Load the font set in to the memory array starting at [0]
 	for (int i = 0; i < 80; i++) {
-		memory[i] = fontSet[i];
+		storeMemory(i, fontSet[i]);
 	}
+
+	//Load the big font set right after it
+	for (int i = 0; i < 160; i++) {
+		storeMemory(BIG_FONT_ADDRESS + i, bigFontSet[i]);
+	}
+
+	clearDecoded();
 }
 
 
 void chip8::loadGame(string rom) {
-	int memIndex = 512; //The index position in the memory array starting at 512 (0x200)
-
 	//Load rom data in to memory array starting at 0x200 (512) to 0xFFF (4095)
 	std::ifstream inputFile;
 	inputFile.open(rom, std::ios::in | std::ios::binary);
-	char ch;
 
-	//Read each char in the ROM file and put it in memory array
-	while (inputFile.get(ch)) {
+	vector<unsigned char> program((istreambuf_iterator<char>(inputFile)), istreambuf_iterator<char>());
+	inputFile.close();
 
-		if (!inputFile.eof()) {
-			memory[memIndex] = ch;
-			memIndex++;
-		}
+	loadProgram(program.data(), program.size());
+}
+
+
+void chip8::loadProgram(const unsigned char* program, size_t size) {
+	size_t memIndex = 512; //The index position in the memory array starting at 512 (0x200)
+
+	for (size_t i = 0; i < size && memIndex < memory.size(); i++, memIndex++) {
+		storeMemory((unsigned short)memIndex, program[i]);
 	}
 
-	inputFile.close();
+	clearDecoded();
+}
+
+
+void chip8::setXoChip(bool enabled)
+{
+	xoChip = enabled;
+
+	unsigned size = enabled ? XO_CHIP_MEMORY_SIZE : CLASSIC_MEMORY_SIZE;
+	memory.assign(size, 0);
+	memoryHash = 0;
+	memoryMask = size - 1;
+
+	decoded.assign(size, decodedOp());
+	clearDecoded();
+}
+
+
+bool chip8::isXoChip() const
+{
+	return xoChip;
 }
 
 
 void chip8::emulateCycle()
+{
+	(this->*cycle)();
+}
+
+
+template <size_t... Flags>
+const chip8::cycleFunction* chip8::cycleTable(index_sequence<Flags...>)
+{
+	static const cycleFunction table[] = { &chip8::executeCycle<quirks<Flags>>... };
+	return table;
+}
+
+
+template <typename Quirks>
+void chip8::runSwitch(int cycles)
+{
+	for (int i = 0; i < cycles; i++) {
+		executeCycle<Quirks>();
+	}
+}
+
+
+template <size_t... Flags>
+const chip8::runFunction* chip8::switchTable(index_sequence<Flags...>)
+{
+	static const runFunction table[] = { &chip8::runSwitch<quirks<Flags>>... };
+	return table;
+}
+
+
+const chip8::runFunction* chip8::switchCores()
+{
+	return switchTable(make_index_sequence<QUIRK_COUNT>());
+}
+
+
+void chip8::setQuirks(unsigned flags)
+{
+	quirkSet = flags % QUIRK_COUNT;
+	cycle = cycleTable(make_index_sequence<QUIRK_COUNT>())[quirkSet];
+	threadedMiss = nullptr;
+
+	switch (core) {
+	case CORE_PREDECODED: run = predecodedCores()[quirkSet]; break;
+	case CORE_THREADED: run = threadedCores()[quirkSet]; break;
+	default: run = switchCores()[quirkSet]; break;
+	}
+}
+
+
+unsigned chip8::getQuirks() const
+{
+	return quirkSet;
+}
+
+
+void chip8::setCore(interpreterCore newCore)
+{
+	core = newCore;
+	setQuirks(quirkSet);
+}
+
+
+interpreterCore chip8::getCore() const
+{
+	return core;
+}
+
+
+void chip8::runCycles(int cycles)
+{
+	(this->*run)(cycles);
+	cycleCount += cycles;
+}
+
+
+unsigned char chip8::readMemory(unsigned short address) const
+{
+	return memory[address & memoryMask];
+}
+
+
+unsigned short chip8::nextOpcode() const
+{
+	return memory[pc & memoryMask] << 8 | memory[(pc + 1) & memoryMask];
+}
+
+
+bool chip8::idle() const
+{
+	//FX0A decoded as emulateCycle() does, where FX3A sets the pitch on XO-CHIP
+	unsigned short next = nextOpcode();
+	bool wait = (next & 0xF00F) == 0xF00A && !(xoChip && (next & 0x00F0) == 0x0030);
+	if (!wait || delay_timer != 0 || sound_timer != 0) {
+		return false;
+	}
+
+	for (int i = 0; i < 16; i++) {
+		if (key[i] == 1) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+memoryAccess chip8::nextAccess() const
+{
+	//Decoded the way executeCycle() will
+	unsigned short opcode = nextOpcode();
+	int x = (opcode & 0x0F00) >> 8;
+	int y = (opcode & 0x00F0) >> 4;
+	memoryAccess access;
+
+	if ((opcode & 0xF000) == 0xD000) {
+		int planes = 0;
+		for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+			planes += (planeMask >> plane) & 1;
+		}
+		access.readFirst = I;
+		access.readCount = ((opcode & 0x000F) == 0 ? 32 : (opcode & 0x000F)) * planes;
+	}
+	else if ((opcode & 0xF00F) == 0xF003) {
+		access.writeFirst = I;
+		access.writeCount = 3;
+	}
+	else if ((opcode & 0xF0FF) == 0xF055) {
+		access.writeFirst = I;
+		access.writeCount = x + 1;
+	}
+	else if ((opcode & 0xF0FF) == 0xF065) {
+		access.readFirst = I;
+		access.readCount = x + 1;
+	}
+	else if (xoChip && opcode == 0xF002) {
+		access.readFirst = I;
+		access.readCount = 16;
+	}
+	else if (xoChip && (opcode & 0xF00F) == 0x5002) {
+		access.writeFirst = I;
+		access.writeCount = (x > y ? x - y : y - x) + 1;
+	}
+	else if (xoChip && (opcode & 0xF00F) == 0x5003) {
+		access.readFirst = I;
+		access.readCount = (x > y ? x - y : y - x) + 1;
+	}
+
+	return access;
+}
+
+
+int chip8::displayWidth() const
+{
+	return hires ? 128 : 64;
+}
+
+
+int chip8::displayHeight() const
+{
+	return hires ? 64 : 32;
+}
+
+
+bool chip8::getPixel(int x, int y) const
+{
+	return getPixelColor(x, y) != 0;
+}
+
+
+int chip8::getPixelColor(int x, int y) const
+{
+	int color = 0;
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (rowPixel(gfx.page(plane)[y % displayHeight()], x % displayWidth())) {
+			color |= 1 << plane;
+		}
+	}
+
+	return color;
+}
+
+
+const displayRow* chip8::displayRows(int plane) const
+{
+	return gfx.page(plane);
+}
+
+
+const unsigned char* chip8::getAudioPattern() const
+{
+	return audioPattern;
+}
+
+
+unsigned char chip8::getAudioPitch() const
+{
+	return audioPitch;
+}
+
+
+unsigned char chip8::getSoundTimer() const
+{
+	return sound_timer;
+}
+
+
+cpuRegisters chip8::getRegisters() const
+{
+	cpuRegisters registers;
+	memcpy(registers.V, V, sizeof(V));
+	registers.I = I;
+	registers.pc = pc;
+	registers.stackPointer = stack_pointer;
+	memcpy(registers.stack, stack, sizeof(stack));
+	registers.delayTimer = delay_timer;
+	registers.soundTimer = sound_timer;
+	return registers;
+}
+
+
+chip8 chip8::fork() const
+{
+	return *this;
+}
+
+
+size_t chip8::unsharedBytes() const
+{
+	return memory.unsharedBytes() + decoded.unsharedBytes() + gfx.unsharedBytes();
+}
+
+
+unsigned long long chip8::stateHash() const
+{
+	//Everything that is not memory or display is a few dozen bytes, so it is simply run through the mixer here
+	unsigned long long words[12] = {
+		(unsigned long long)I << 48 | (unsigned long long)pc << 32 | (unsigned long long)stack_pointer << 16 |
+			(unsigned long long)delay_timer << 8 | sound_timer,
+		(unsigned long long)hires << 24 | (unsigned long long)planeMask << 16 | (unsigned long long)audioPitch << 8 | xoChip
+	};
+	memcpy(&words[2], V, sizeof(V));
+	memcpy(&words[4], stack, sizeof(stack));
+	memcpy(&words[8], audioPattern, sizeof(audioPattern));
+	memcpy(&words[10], rplFlags, sizeof(rplFlags));
+
+	unsigned long long hash = memoryHash ^ hashMix(displayHash + 1);
+	for (unsigned long long word : words) {
+		hash = hashMix(hash ^ word);
+	}
+	return hash;
+}
+
+
+template <typename Quirks>
+void chip8::executeCycle()
 {
 	//FETCH OpCode from memory. Each element in memory array stores 1 Byte (half an opcode), so two sequential elements must be combined to form one 2 Byte Opcode. The bitwise OR operator combines them.
-	opcode = memory[pc] << 8 | memory[pc + 1];
+	opcode = memory[pc & memoryMask] << 8 | memory[(pc + 1) & memoryMask];
 
 	//DECODE & EXECUTE the Opcode. Find out which opcode it is by the first four bits (by using the Bitwise AND operator).
 	switch (opcode & 0xF000) {
@@ -109,63 +435,26 @@ void chip8::emulateCycle()
 		break;
 	case 0xB000: //BNNN: The program counter is set to nnn plus the value of V0.
 
-		pc = (opcode & 0x0FFF) + V[0];
+		if constexpr (Quirks::jumpVx) {
+			pc = (opcode & 0x0FFF) + V[(opcode & 0x0F00) >> 8]; //BXNN: XNN plus the value of Vx
+		}
+		else {
+			pc = (opcode & 0x0FFF) + V[0];
+		}
 
 		break;
 	case 0xC000: //CXKK - Set Vx = random byte AND kk
 	{
-		//Generate a random number between 0 and 255
-		uniform_int_distribution<int> distribution(0, 255);
-		int randNum = distribution(randDevice);
-
 		//V[x] stores result of bitwise AND between random number and value 'kk'
-		V[(opcode & 0x0F00) >> 8] = randNum & (opcode & 0x00FF);
+		V[(opcode & 0x0F00) >> 8] = randomByte() & (opcode & 0x00FF);
 
 		pc += 2;
 	}
 	break;
 	case 0xD000: //DXYN - DRW Vx, Vy, nibble
 	{
-		bool pixelFlipped = false;
-
 		//Read N-bytes from memory array starting at address stored in I. Display sprites at coordinates (Vx, Vy)
-		unsigned char xCoord = V[(opcode & 0x0F00) >> 8]; //x coord
-		unsigned char yCoord = V[(opcode & 0x00F0) >> 4]; //y coord
-
-		//Get newSprite
-		for (int i = 0; i < (opcode & 0x000F); i++) {
-
-			unsigned char newSprite = memory[I + i]; //sprite-byte in memory array
-			unsigned char compareByte = 0x80; //10000000 in binary
-
-			//Set gfx values using newSprite
-			for (int k = 0; k < 8; k++) {
-
-				if ((compareByte & newSprite) == compareByte) {
-
-					if (gfx[(((xCoord + k) % 64) + (((yCoord + i) % 32) * 64))] == 1) {
-
-						pixelFlipped = true;
-					}
-
-					gfx[(((xCoord + k) % 64) + (((yCoord + i) % 32) * 64))] ^= 1;
-				}
-				else {
-
-					gfx[(((xCoord + k) % 64) + (((yCoord + i) % 32) * 64))] ^= 0;
-				}
-
-				compareByte /= 2; //Decrease comparison byte to compare the next less signigficant bit
-			}
-		}
-
-		//Set V[F]
-		if (pixelFlipped == true) {
-			V[0xF] = 1;
-		}
-		else {
-			V[0xF] = 0;
-		}
+		drawSprite<Quirks::clipSprites>(V[(opcode & 0x0F00) >> 8], V[(opcode & 0x00F0) >> 4], opcode & 0x000F);
 
 		//Increment pc
 		pc += 2;
@@ -176,7 +465,7 @@ void chip8::emulateCycle()
 		case 0x000E: //Ex9E - Skip next instruction if key with the value of Vx is pressed
 		{
 			if (key[V[(opcode & 0x0F00) >> 8]] == 1) {
-				pc += 4;
+				pc += skipLength();
 			}
 			else {
 				pc += 2;
@@ -186,7 +475,7 @@ void chip8::emulateCycle()
 		case 0x0001: //ExA1 - Skip next instruction if key with the value of Vx is not pressed.
 
 			if (key[V[(opcode & 0x0F00) >> 8]] == 0) {
-				pc += 4;
+				pc += skipLength();
 			}
 			else {
 				pc += 2;
@@ -195,21 +484,53 @@ void chip8::emulateCycle()
 		}
 		break;
 	case 0x0000:
-		switch (opcode & 0x000F) {
-		case 0x0000: //0x00E0 - Clears the screen
-
-			for (int i = 0; i < 2048; i++) {
-				gfx[i] = 0;
-			}
+		if ((opcode & 0xFFF0) == 0x00C0) { //0x00CN - Scroll the screen down N lines (SUPER-CHIP)
+			scrollDown(opcode & 0x000F);
+			pc += 2;
+			break;
+		}
 
-			pc += 2; //Increment program counter by 2 (one would only be half an opcode).
+		if (xoChip && (opcode & 0xFFF0) == 0x00D0) { //0x00DN - Scroll the screen up N lines (XO-CHIP)
+			scrollUp(opcode & 0x000F);
+			pc += 2;
 			break;
-		case 0x000E: //0x000E - Returns from subroutine
+		}
 
-			stack_pointer--;
-			pc = stack[stack_pointer]; //Set program counter to address at top of the stack
+		switch (opcode) {
+		case 0x00FB: //0x00FB - Scroll the screen right 4 pixels (SUPER-CHIP)
+			scrollRight();
 			pc += 2;
 			break;
+		case 0x00FC: //0x00FC - Scroll the screen left 4 pixels (SUPER-CHIP)
+			scrollLeft();
+			pc += 2;
+			break;
+		case 0x00FD: //0x00FD - Exit the interpreter (SUPER-CHIP). pc stays here, so the program halts.
+			break;
+		case 0x00FE: //0x00FE - Switch to the 64 x 32 screen (SUPER-CHIP)
+			setHires(false);
+			pc += 2;
+			break;
+		case 0x00FF: //0x00FF - Switch to the 128 x 64 screen (SUPER-CHIP)
+			setHires(true);
+			pc += 2;
+			break;
+		default:
+			switch (opcode & 0x000F) {
+			case 0x0000: //0x00E0 - Clears the screen
+
+				clearScreen();
+
+				pc += 2; //Increment program counter by 2 (one would only be half an opcode).
+				break;
+			case 0x000E: //0x000E - Returns from subroutine
+
+				stack_pointer--;
+				pc = stack[stack_pointer]; //Set program counter to address at top of the stack
+				pc += 2;
+				break;
+			}
+			break;
 		}
 		break;
 	case 0xF000:
@@ -222,6 +543,12 @@ void chip8::emulateCycle()
 
 		case 0x000A: //FX0A - Wait for a key press, store the value of the key in Vx
 		{
+			if (xoChip && (opcode & 0x00F0) == 0x0030) { //0xFX3A - Set the audio pitch register to Vx (XO-CHIP)
+				audioPitch = V[(opcode & 0x0F00) >> 8];
+				pc += 2;
+				break;
+			}
+
 			for (int i = 0; i < 16; i++) {
 				if (key[i] == 1) {
 
@@ -253,10 +580,35 @@ void chip8::emulateCycle()
 			pc += 2;
 			break;
 
+		case 0x0000: //0xFX30 - Set I = location of the 8x10 sprite for digit Vx (SUPER-CHIP)
+			if (xoChip && opcode == 0xF000) { //0xF000 NNNN - Set I = the 16-bit address NNNN in the next two bytes (XO-CHIP)
+				I = memory[(pc + 2) & memoryMask] << 8 | memory[(pc + 3) & memoryMask];
+				pc += 4;
+			}
+			else if ((opcode & 0x00F0) == 0x0030) {
+				I = BIG_FONT_ADDRESS + (V[(opcode & 0x0F00) >> 8] & 0xF) * 10;
+				pc += 2;
+			}
+			break;
+
+		case 0x0001: //0xFN01 - Select the bitplanes in N for drawing, clearing and scrolling (XO-CHIP)
+			if (xoChip && (opcode & 0x00F0) == 0x0000) {
+				planeMask = ((opcode & 0x0F00) >> 8) & ((1 << DISPLAY_PLANES) - 1);
+				pc += 2;
+			}
+			break;
+
+		case 0x0002: //0xF002 - Load the audio pattern buffer from memory[I] (XO-CHIP)
+			if (xoChip && opcode == 0xF002) {
+				loadAudioPattern();
+				pc += 2;
+			}
+			break;
+
 		case 0x0003: //0xFX33 - Store BCD representation of Vx in memory locations I, I+1, and I+2
-			memory[I] = (V[(opcode & 0x0F00) >> 8]) / 100; //Hundreds Digit
-			memory[I + 1] = ((V[(opcode & 0x0F00) >> 8]) / 10) % 10; //Tens Digit
-			memory[I + 2] = (V[(opcode & 0x0F00) >> 8]) % 10; //Ones Digit
+			storeMemory(I, (V[(opcode & 0x0F00) >> 8]) / 100); //Hundreds Digit
+			storeMemory(I + 1, ((V[(opcode & 0x0F00) >> 8]) / 10) % 10); //Tens Digit
+			storeMemory(I + 2, (V[(opcode & 0x0F00) >> 8]) % 10); //Ones Digit
 			pc += 2;
 			break;
 		case 0x0005:
@@ -269,14 +621,34 @@ void chip8::emulateCycle()
 
 			case 0x0050: //0xFX55 - Store registers V0 through Vx in memory starting at location I
 				for (int j = 0; j <= ((opcode & 0x0F00) >> 8); j++) {
-					memory[I + j] = V[j];
+					storeMemory(I + j, V[j]);
+				}
+				if constexpr (Quirks::loadStoreIncrementsI) {
+					I += ((opcode & 0x0F00) >> 8) + 1;
 				}
 				pc += 2;
 				break;
 
 			case 0x0060: //0xFX65 - The interpreter reads values from memory starting at location I into registers V0 through Vx
 				for (int j = 0; j <= ((opcode & 0x0F00) >> 8); j++) {
-					V[j] = memory[I + j];
+					V[j] = memory[(I + j) & memoryMask];
+				}
+				if constexpr (Quirks::loadStoreIncrementsI) {
+					I += ((opcode & 0x0F00) >> 8) + 1;
+				}
+				pc += 2;
+				break;
+
+			case 0x0070: //0xFX75 - Save V0 through Vx in the RPL user flags (SUPER-CHIP)
+				for (int j = 0; j <= ((opcode & 0x0F00) >> 8); j++) {
+					rplFlags[j] = V[j];
+				}
+				pc += 2;
+				break;
+
+			case 0x0080: //0xFX85 - Load V0 through Vx from the RPL user flags (SUPER-CHIP)
+				for (int j = 0; j <= ((opcode & 0x0F00) >> 8); j++) {
+					V[j] = rplFlags[j];
 				}
 				pc += 2;
 				break;
@@ -295,7 +667,7 @@ void chip8::emulateCycle()
 		break;
 	case 0x3000: //0x3xkk - Skip next instruction if Vx = kk
 		if (V[(opcode & 0x0F00) >> 8] == (opcode & 0x00FF)) {
-			pc += 4;
+			pc += skipLength();
 		}
 		else {
 			pc += 2;
@@ -303,15 +675,23 @@ void chip8::emulateCycle()
 		break;
 	case 0x4000: //0x4xkk - Skip next instruction if Vx != kk
 		if (V[(opcode & 0x0F00) >> 8] != (opcode & 0x00FF)) {
-			pc += 4;
+			pc += skipLength();
 		}
 		else {
 			pc += 2;
 		}
 		break;
-	case 0x5000: //0x5xy0 - Skip next instruction if Vx = Vy
-		if (V[(opcode & 0x0F00) >> 8] == V[(opcode & 0x00F0) >> 4]) {
-			pc += 4;
+	case 0x5000:
+		if (xoChip && (opcode & 0x000F) == 0x0002) { //0x5xy2 - Store Vx through Vy in memory starting at I (XO-CHIP)
+			saveRange((opcode & 0x0F00) >> 8, (opcode & 0x00F0) >> 4);
+			pc += 2;
+		}
+		else if (xoChip && (opcode & 0x000F) == 0x0003) { //0x5xy3 - Read Vx through Vy from memory starting at I (XO-CHIP)
+			loadRange((opcode & 0x0F00) >> 8, (opcode & 0x00F0) >> 4);
+			pc += 2;
+		}
+		else if (V[(opcode & 0x0F00) >> 8] == V[(opcode & 0x00F0) >> 4]) { //0x5xy0 - Skip next instruction if Vx = Vy
+			pc += skipLength();
 		}
 		else {
 			pc += 2;
@@ -334,14 +714,23 @@ void chip8::emulateCycle()
 			break;
 		case 0x0001: //0x8xy1 - Set Vx = Vx OR Vy 
 			V[(opcode & 0x0F00) >> 8] = (V[(opcode & 0x0F00) >> 8] | V[(opcode & 0x00F0) >> 4]);
+			if constexpr (Quirks::vfReset) {
+				V[0xF] = 0;
+			}
 			pc += 2;
 			break;
 		case 0x002: //0x8xy2 - Set Vx = Vx AND Vy
 			V[(opcode & 0x0F00) >> 8] = (V[(opcode & 0x0F00) >> 8] & V[(opcode & 0x00F0) >> 4]);
+			if constexpr (Quirks::vfReset) {
+				V[0xF] = 0;
+			}
 			pc += 2;
 			break;
 		case 0x0003: //0x8xy3 - Set Vx = Vx XOR Vy
 			V[(opcode & 0x0F00) >> 8] = (V[(opcode & 0x0F00) >> 8] ^ V[(opcode & 0x00F0) >> 4]);
+			if constexpr (Quirks::vfReset) {
+				V[0xF] = 0;
+			}
 			pc += 2;
 			break;
 		case 0x0004: //0x8xy4 - Set Vx = Vx + Vy, set VF = carry
@@ -371,20 +760,23 @@ void chip8::emulateCycle()
 			pc += 2;
 			break;
 		case 0x0006: //0x8xy6 - Set Vx = Vx SHR 1
+		{
+			//The COSMAC VIP shifts V[y] in to V[x]; later interpreters shift V[x] in place
+			unsigned char source = Quirks::shiftVy ? V[(opcode & 0x00F0) >> 4] : V[(opcode & 0x0F00) >> 8];
 
-			//Check if the least significant bit of V[x] is 1
-			if (V[(opcode & 0x0F00) >> 8] & 1 == 1) {
+			//Check if the least significant bit of the source is 1
+			if ((source & 1) == 1) {
 				V[0xF] = 1;
 			}
 			else {
 				V[0XF] = 0;
 			}
 
-			//Bit-Shift V[x] right by 1
-			V[(opcode & 0x0F00) >> 8] >>= 1;
+			//Bit-Shift the source right by 1
+			V[(opcode & 0x0F00) >> 8] = source >> 1;
 
 			pc += 2;
-
+		}
 			break;
 		case 0x0007: //0x8xy7 - Set Vx = Vy - Vx, set VF = NOT borrow.
 
@@ -399,21 +791,24 @@ void chip8::emulateCycle()
 			pc += 2;
 			break;
 		case 0x000E: //0x8xyE - Set Vx = Vx SHL 1
+		{
+			unsigned char source = Quirks::shiftVy ? V[(opcode & 0x00F0) >> 4] : V[(opcode & 0x0F00) >> 8];
 
-			//V[F] is set to the Most Significant Bit of V[x]. If V[x] is less than 8 bits, the MSB is 0.
-			V[0xF] = V[(opcode & 0x0F00) >> 8] >> 7;
+			//V[F] is set to the Most Significant Bit of the source. If the source is less than 8 bits, the MSB is 0.
+			V[0xF] = source >> 7;
 
-			//Bit-shift V[x] left by 1
-			V[(opcode & 0x0F00) >> 8] <<= 1;
+			//Bit-shift the source left by 1
+			V[(opcode & 0x0F00) >> 8] = source << 1;
 
 			pc += 2;
+		}
 			break;
 		}
 		break;
 	case 0x9000: //9xy0 - Skip next instruction if Vx != Vy
 
 		if ((V[(opcode & 0x0F00) >> 8]) != (V[(opcode & 0x00F0) >> 4])) {
-			pc += 4;
+			pc += skipLength();
 		}
 		else {
 			pc += 2;
@@ -427,6 +822,210 @@ void chip8::emulateCycle()
 }
 
 
+template <bool Clip>
+void chip8::drawSprite(unsigned char xCoord, unsigned char yCoord, int height)
+{
+	const int width = displayWidth();
+	const int lines = displayHeight();
+	const displayRow screenMask = rowMask(width);
+
+	//DXY0 draws a 16x16 sprite, two bytes per line
+	const int spriteWidth = height == 0 ? 16 : 8;
+	const int lineBytes = spriteWidth / 8;
+	if (height == 0) {
+		height = 16;
+	}
+
+	//Sprites start at the wrapped coordinate
+	const int x = xCoord % width;
+	const int y = yCoord % lines;
+
+	bool pixelFlipped = false;
+	unsigned spriteAddress = I;
+
+	//The sprite is drawn in every selected plane. With more than one plane (XO-CHIP), each plane takes the next sprite in memory.
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+
+		if ((planeMask & (1 << plane)) == 0) {
+			continue;
+		}
+
+		displayRow* rows = gfx.writablePage(plane);
+
+		for (int i = 0; i < height; i++) {
+
+			//Clipped sprites stop at the bottom edge...
+			if constexpr (Clip) {
+				if (y + i >= lines) {
+					break;
+				}
+			}
+
+			//Get the sprite line from memory and move it in to place
+			unsigned bits = memory[(spriteAddress + i * lineBytes) & memoryMask];
+			if (spriteWidth == 16) {
+				bits = (bits << 8) | memory[(spriteAddress + i * 2 + 1) & memoryMask];
+			}
+			displayRow sprite = spriteRow(bits, spriteWidth);
+			displayRow newSprite = rowAnd(rowShiftRight(sprite, x), screenMask);
+
+			//...and at the right edge. Otherwise the part past the edge wraps round to the left.
+			if constexpr (!Clip) {
+				if (x + spriteWidth > width) {
+					newSprite = rowOr(newSprite, rowShiftLeft(sprite, width - x));
+				}
+			}
+
+			const int line = (y + i) % lines;
+
+			if (!rowIsEmpty(rowAnd(rows[line], newSprite))) {
+				pixelFlipped = true;
+			}
+
+			storeRow(rows, plane, line, rowXor(rows[line], newSprite));
+		}
+
+		spriteAddress += height * lineBytes;
+	}
+
+	//Set V[F]
+	if (pixelFlipped == true) {
+		V[0xF] = 1;
+	}
+	else {
+		V[0xF] = 0;
+	}
+}
+
+template void chip8::drawSprite<false>(unsigned char, unsigned char, int);
+template void chip8::drawSprite<true>(unsigned char, unsigned char, int);
+
+
+void chip8::clearScreen()
+{
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (planeMask & (1 << plane)) {
+			displayRow* rows = gfx.writablePage(plane);
+			for (int i = 0; i < 64; i++) {
+				storeRow(rows, plane, i, displayRow{ 0, 0 });
+			}
+		}
+	}
+}
+
+
+void chip8::scrollDown(int lines)
+{
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (planeMask & (1 << plane)) {
+			displayRow* rows = gfx.writablePage(plane);
+			for (int i = displayHeight() - 1; i >= 0; i--) {
+				storeRow(rows, plane, i, i >= lines ? rows[i - lines] : displayRow{ 0, 0 });
+			}
+		}
+	}
+}
+
+
+void chip8::scrollUp(int lines)
+{
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (planeMask & (1 << plane)) {
+			displayRow* rows = gfx.writablePage(plane);
+			for (int i = 0; i < displayHeight(); i++) {
+				storeRow(rows, plane, i, i + lines < displayHeight() ? rows[i + lines] : displayRow{ 0, 0 });
+			}
+		}
+	}
+}
+
+
+void chip8::scrollRight()
+{
+	const displayRow screenMask = rowMask(displayWidth());
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (planeMask & (1 << plane)) {
+			displayRow* rows = gfx.writablePage(plane);
+			for (int i = 0; i < displayHeight(); i++) {
+				storeRow(rows, plane, i, rowAnd(rowShiftRight(rows[i], 4), screenMask));
+			}
+		}
+	}
+}
+
+
+void chip8::scrollLeft()
+{
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (planeMask & (1 << plane)) {
+			displayRow* rows = gfx.writablePage(plane);
+			for (int i = 0; i < displayHeight(); i++) {
+				storeRow(rows, plane, i, rowShiftLeft(rows[i], 4));
+			}
+		}
+	}
+}
+
+
+void chip8::setHires(bool enabled)
+{
+	hires = enabled;
+
+	//Switching resolution clears every plane, not just the selected ones
+	gfx.assign(DISPLAY_PLANES * 64, displayRow{ 0, 0 });
+	displayHash = 0;
+}
+
+
+void chip8::saveRange(int first, int last)
+{
+	int step = first <= last ? 1 : -1;
+
+	for (int j = 0; ; j++) {
+		storeMemory(I + j, V[first + j * step]);
+		if (first + j * step == last) {
+			break;
+		}
+	}
+}
+
+
+void chip8::loadRange(int first, int last)
+{
+	int step = first <= last ? 1 : -1;
+
+	for (int j = 0; ; j++) {
+		V[first + j * step] = memory[(I + j) & memoryMask];
+		if (first + j * step == last) {
+			break;
+		}
+	}
+}
+
+
+void chip8::loadAudioPattern()
+{
+	for (int i = 0; i < 16; i++) {
+		audioPattern[i] = memory[(I + i) & memoryMask];
+	}
+}
+
+
+unsigned char chip8::randomByte()
+{
+	//Generate a random number between 0 and 255
+	uniform_int_distribution<int> distribution(0, 255);
+	return distribution(randEngine);
+}
+
+
+void chip8::seedRandom(unsigned seed)
+{
+	randEngine.seed(seed);
+}
+
+
 void chip8::decreaseTimers() {
 
 	if (delay_timer > 0)
@@ -437,33 +1036,40 @@ void chip8::decreaseTimers() {
 }
 
 
+#ifndef CHIP8_HEADLESS
 void chip8::drawPixels() {
 	glBegin(GL_QUADS);
 
-	//Set Pixel color
-	glColor3f(0, 1, 0);
+	for (int i = 0; i < displayHeight(); i++) {
 
-	int k = 0;
+		//Skip blank lines without looking at each pixel
+		bool blank = true;
+		for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+			blank = blank && rowIsEmpty(gfx.page(plane)[i]);
+		}
+		if (blank) {
+			continue;
+		}
+
+		for (int j = 0; j < displayWidth(); j++) {
 
-	for (int i = 0; i < 32; i++) {
+			int color = getPixelColor(j, i);
 
-		for (int j = 0; j < 64; j++) {
+			if (color != 0) {
 
-			if (gfx[k] == 1) {
+				//Set Pixel color
+				glColor3f(displayPalette[color][0], displayPalette[color][1], displayPalette[color][2]);
 
 				glVertex2i(j, i); // top left
 				glVertex2i(j + 1, i); // top right
 				glVertex2i(j + 1, i + 1); //bottom right
 				glVertex2i(j, i + 1); //bottom left
-				k++;
-			}
-			else {
-				k++;
 			}
 		}
 	}
 	glEnd();
 }
+#endif
 
 
 //#########################################################################################################
@@ -491,8 +1097,8 @@ void chip8::testEmulateCycle() {
 	cout << "\n";
 
 	//Add ANNN opcode to memory array
-	memory[0] = 0xA0;
-	memory[1] = 0x00;
+	storeMemory(0, 0xA0);
+	storeMemory(1, 0x00);
 
 	cout << "Attmepting to run opcode: ANNN" << endl;
 	cout << "---------------------------------" << endl;
@@ -500,24 +1106,24 @@ void chip8::testEmulateCycle() {
 	cout << "I = " << I << endl;
 
 	//Add 0x00E0 opcode to memory array
-	memory[2] = 0x00;
-	memory[3] = 0xE0;
+	storeMemory(2, 0x00);
+	storeMemory(3, 0xE0);
 
 	cout << "\nAttmepting to run opcode: 0x00E0" << endl;
 	cout << "---------------------------------" << endl;
 	emulateCycle();
 
 	//Add 0x000E opcode to memory array
-	memory[4] = 0x00;
-	memory[5] = 0x0E;
+	storeMemory(4, 0x00);
+	storeMemory(5, 0x0E);
 
 	cout << "\nAttmepting to run opcode: 0x000E" << endl;
 	cout << "---------------------------------" << endl;
 	emulateCycle();
 
 	//Add 0x1NNN opcode to memory array
-	memory[6] = 0x1A;
-	memory[7] = 0xAA;
+	storeMemory(6, 0x1A);
+	storeMemory(7, 0xAA);
 	pc = 6;
 
 	cout << "\nAttmepting to run opcode: 0x1NNN" << endl;
@@ -525,8 +1131,8 @@ void chip8::testEmulateCycle() {
 	emulateCycle();
 
 	//Add 0x2NNN opcode to memory array
-	memory[8] = 0x2A;
-	memory[9] = 0xBC;
+	storeMemory(8, 0x2A);
+	storeMemory(9, 0xBC);
 	pc = 8;
 
 	cout << "\nAttmepting to run opcode: 0x2NNN" << endl;
@@ -534,8 +1140,8 @@ void chip8::testEmulateCycle() {
 	emulateCycle();
 
 	//Add 0x3xkk opcode to memory array
-	memory[10] = 0x3A;
-	memory[11] = 0xBC;
+	storeMemory(10, 0x3A);
+	storeMemory(11, 0xBC);
 	pc = 10;
 
 	cout << "\nAttmepting to run opcode: 0x3xkk" << endl;
@@ -543,8 +1149,8 @@ void chip8::testEmulateCycle() {
 	emulateCycle();
 
 	//Add 0x4xkk opcode to memory array
-	memory[12] = 0x4A;
-	memory[13] = 0xAA;
+	storeMemory(12, 0x4A);
+	storeMemory(13, 0xAA);
 	pc = 12;
 
 	cout << "\nAttmepting to run opcode: 0x4xkk" << endl;
@@ -552,8 +1158,8 @@ void chip8::testEmulateCycle() {
 	emulateCycle();
 
 	//Add 0x5xy0 opcode to memory array
-	memory[14] = 0x5A;
-	memory[15] = 0xB0;
+	storeMemory(14, 0x5A);
+	storeMemory(15, 0xB0);
 	pc = 14;
 
 	cout << "\nAttempting to run opcode: 0x5xy0" << endl;
@@ -561,8 +1167,8 @@ void chip8::testEmulateCycle() {
 	emulateCycle();
 
 	//Add 0x6xkk opcode to memory array
-	memory[16] = 0x60;
-	memory[17] = 0xAA;
+	storeMemory(16, 0x60);
+	storeMemory(17, 0xAA);
 	pc = 16;
 
 	cout << "\nAttempting to run opcode: 0x6xkk" << endl;
@@ -571,8 +1177,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value at V[" << ((opcode & 0x0F00) >> 8) << "] = " << hex << (int)V[(opcode & 0x0F00) >> 8] << endl;
 
 	//Add 0x7xkk opcode to memory array
-	memory[18] = 0x71;
-	memory[19] = 0x01;
+	storeMemory(18, 0x71);
+	storeMemory(19, 0x01);
 	pc = 18;
 
 	cout << "\nAttempting to run opcode: 0x7xkk" << endl;
@@ -583,8 +1189,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value of V[" << ((opcode & 0x0F00) >> 8) << "] after: " << hex << (int)V[(opcode & 0x0F00) >> 8] << endl;
 
 	//Add 0x8xy0 opcode to memory array
-	memory[20] = 0x80;
-	memory[21] = 0x10;
+	storeMemory(20, 0x80);
+	storeMemory(21, 0x10);
 	pc = 20;
 
 	cout << "\nAttempting to run opcode: 0x8xy0" << endl;
@@ -595,8 +1201,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value of V[0] after = " << (int)V[(opcode & 0x0F00) >> 8] << endl;
 
 	//Add 0x8xy1 opcode to memory array
-	memory[22] = 0x80;
-	memory[23] = 0xA1;
+	storeMemory(22, 0x80);
+	storeMemory(23, 0xA1);
 	pc = 22;
 
 	cout << "\nAttempting to run opcode: 0x8xy1" << endl;
@@ -607,8 +1213,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value of V[0] after = " << (int)V[(opcode & 0x0F00) >> 8] << endl;
 
 	//Add 0x8xy2 opcode to memory array
-	memory[24] = 0x80;
-	memory[25] = 0xA2;
+	storeMemory(24, 0x80);
+	storeMemory(25, 0xA2);
 	pc = 24;
 
 	cout << "\nAttempting to run opcode: 0x8xy2" << endl;
@@ -619,8 +1225,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value of V[0] after = " << (int)V[(opcode & 0x0F00) >> 8] << endl;
 
 	//Add 0x8xy3 opcode to memory array
-	memory[26] = 0x80;
-	memory[27] = 0x23;
+	storeMemory(26, 0x80);
+	storeMemory(27, 0x23);
 	pc = 26;
 
 
@@ -633,8 +1239,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add 0x8xy4 opcode to memory array
-	memory[28] = 0x80;
-	memory[29] = 0x14;
+	storeMemory(28, 0x80);
+	storeMemory(29, 0x14);
 	pc = 28;
 
 	V[0] = 0xFF;
@@ -650,8 +1256,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add 0x8xy5 opcode to memory array
-	memory[30] = 0x80;
-	memory[31] = 0x15;
+	storeMemory(30, 0x80);
+	storeMemory(31, 0x15);
 	pc = 30;
 
 	V[0] = 0xa;
@@ -667,8 +1273,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add 8xy6 opcode to memory array
-	memory[32] = 0x80;
-	memory[33] = 0x16;
+	storeMemory(32, 0x80);
+	storeMemory(33, 0x16);
 	pc = 32;
 
 	V[0] = 0xFF;
@@ -684,8 +1290,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add 8xy7 opcode to memory array
-	memory[34] = 0x80;
-	memory[35] = 0x17;
+	storeMemory(34, 0x80);
+	storeMemory(35, 0x17);
 	pc = 34;
 
 	V[0] = 0x3;
@@ -700,8 +1306,8 @@ void chip8::testEmulateCycle() {
 	cout << "Value of V[F] after = " << (int)V[0xF] << endl;
 
 	//Add 8xyE opcode to memory array
-	memory[36] = 0x80;
-	memory[37] = 0x1E;
+	storeMemory(36, 0x80);
+	storeMemory(37, 0x1E);
 	pc = 36;
 
 	V[0] = 0xFF;
@@ -717,8 +1323,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add 9xy0 opcode to memory array
-	memory[38] = 0x90;
-	memory[39] = 0x10;
+	storeMemory(38, 0x90);
+	storeMemory(39, 0x10);
 	pc = 38;
 
 	V[0] = 0xF;
@@ -735,8 +1341,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add BNNN opcode to memory array
-	memory[40] = 0xBA;
-	memory[41] = 0xAA;
+	storeMemory(40, 0xBA);
+	storeMemory(41, 0xAA);
 	pc = 40;
 
 	V[0] = 0x1;
@@ -750,8 +1356,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add Cxkk opcode to memory array
-	memory[42] = 0xC0;
-	memory[43] = 0x0B;
+	storeMemory(42, 0xC0);
+	storeMemory(43, 0x0B);
 	pc = 42;
 
 	V[0] = 0;
@@ -765,23 +1371,23 @@ void chip8::testEmulateCycle() {
 
 
 	//Add Dxyn opcode to memory array
-	memory[44] = 0xD0;
-	memory[45] = 0x0A;
+	storeMemory(44, 0xD0);
+	storeMemory(45, 0x0A);
 	pc = 44;
 
 	//0
-	memory[0] = 0xF0;
-	memory[1] = 0x90;
-	memory[2] = 0x90;
-	memory[3] = 0x90;
-	memory[4] = 0xF0;
+	storeMemory(0, 0xF0);
+	storeMemory(1, 0x90);
+	storeMemory(2, 0x90);
+	storeMemory(3, 0x90);
+	storeMemory(4, 0xF0);
 
 	//1
-	memory[5] = 0x20;
-	memory[6] = 0x60;
-	memory[7] = 0x20;
-	memory[8] = 0x20;
-	memory[9] = 0x70;
+	storeMemory(5, 0x20);
+	storeMemory(6, 0x60);
+	storeMemory(7, 0x20);
+	storeMemory(8, 0x20);
+	storeMemory(9, 0x70);
 
 	I = 0;
 	V[0] = 0;
@@ -792,8 +1398,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add Ex9E opcode to memory array
-	memory[46] = 0xE1;
-	memory[47] = 0x9E;
+	storeMemory(46, 0xE1);
+	storeMemory(47, 0x9E);
 	pc = 46;
 
 	V[1] = 65; //65 is ASCII for 'A'
@@ -806,8 +1412,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add ExA1 opcode to memory array
-	memory[48] = 0xE1;
-	memory[49] = 0xA1;
+	storeMemory(48, 0xE1);
+	storeMemory(49, 0xA1);
 	pc = 48;
 
 	V[1] = 65; //65 is ASCII for 'A'
@@ -820,8 +1426,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX07 opcode to memory array
-	memory[50] = 0xF1;
-	memory[51] = 0x07;
+	storeMemory(50, 0xF1);
+	storeMemory(51, 0x07);
 	pc = 50;
 
 	V[1] = 0;
@@ -835,8 +1441,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX0A opcode to memory array
-	memory[52] = 0xF1;
-	memory[53] = 0x0A;
+	storeMemory(52, 0xF1);
+	storeMemory(53, 0x0A);
 	pc = 52;
 
 	V[1] = 0;
@@ -849,8 +1455,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX15 opcode to the memory array
-	memory[54] = 0xF1;
-	memory[55] = 0x15;
+	storeMemory(54, 0xF1);
+	storeMemory(55, 0x15);
 	pc = 54;
 
 	V[1] = 10;
@@ -864,8 +1470,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX18 opcode to memory array
-	memory[56] = 0xF1;
-	memory[57] = 0x18;
+	storeMemory(56, 0xF1);
+	storeMemory(57, 0x18);
 	pc = 56;
 
 	V[1] = 9;
@@ -878,8 +1484,8 @@ void chip8::testEmulateCycle() {
 	cout << "Sound Timer after = " << (int)sound_timer << endl;
 
 	//Add FX1E opcode to memory array
-	memory[58] = 0xF1;
-	memory[59] = 0x1E;
+	storeMemory(58, 0xF1);
+	storeMemory(59, 0x1E);
 	pc = 58;
 
 	V[1] = 10;
@@ -892,8 +1498,8 @@ void chip8::testEmulateCycle() {
 	cout << "Index Register after = " << I << endl;
 
 	//Add FX29 opcode to memory array
-	memory[60] = 0xF1;
-	memory[61] = 0x29;
+	storeMemory(60, 0xF1);
+	storeMemory(61, 0x29);
 	pc = 60;
 
 	V[1] = 0xa;
@@ -907,8 +1513,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX33 opcode to memory array
-	memory[62] = 0xF1;
-	memory[63] = 0x33;
+	storeMemory(62, 0xF1);
+	storeMemory(63, 0x33);
 	pc = 62;
 
 	V[1] = 123;
@@ -924,8 +1530,8 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX55 opcode to memory
-	memory[64] = 0xF5;
-	memory[65] = 0x55;
+	storeMemory(64, 0xF5);
+	storeMemory(65, 0x55);
 	pc = 64;
 
 	I = 0;
@@ -956,17 +1562,17 @@ void chip8::testEmulateCycle() {
 
 
 	//Add FX65 opcode to memory
-	memory[66] = 0xF5;
-	memory[67] = 0x65;
+	storeMemory(66, 0xF5);
+	storeMemory(67, 0x65);
 	pc = 66;
 
 	I = 0;
-	memory[0] = 55;
-	memory[1] = 54;
-	memory[2] = 53;
-	memory[3] = 52;
-	memory[4] = 51;
-	memory[5] = 50;
+	storeMemory(0, 55);
+	storeMemory(1, 54);
+	storeMemory(2, 53);
+	storeMemory(3, 52);
+	storeMemory(4, 51);
+	storeMemory(5, 50);
 
 	cout << "\nAttempting to run opcode: 0xFX65" << endl;
 	cout << "---------------------------------" << endl;
@@ -997,7 +1603,7 @@ void chip8::displayTest() {
 	for (int i = 0; i < 80; i++) {
 
 
-		memory[i] = fontSet[i];
+		storeMemory(i, fontSet[i]);
 	}
 
 	//Initialize variables
@@ -1012,8 +1618,8 @@ void chip8::displayTest() {
 	//Print the numbers (0-9)
 	for (int j = 0; j < 10; j++) {
 
-		memory[memIndex_a] = 0xD0;
-		memory[memIndex_b] = 0x15;
+		storeMemory(memIndex_a, 0xD0);
+		storeMemory(memIndex_b, 0x15);
 
 		emulateCycle();
 
@@ -1031,8 +1637,8 @@ void chip8::displayTest() {
 	//Print the hex letters (A-F)
 	for (int k = 0; k < 6; k++) {
 
-		memory[memIndex_a] = 0xD0;
-		memory[memIndex_b] = 0x15;
+		storeMemory(memIndex_a, 0xD0);
+		storeMemory(memIndex_b, 0x15);
 
 		emulateCycle();
 
@@ -1053,7 +1659,7 @@ void chip8::displayTest2() {
 	//Initialize variables
 	I = 0;
 	pc = 1;
-	memory[0] = 0x80; //10000000
+	storeMemory(0, 0x80); //10000000
 
 	//Print pixels (quads) at four corners of screen
 
@@ -1061,32 +1667,32 @@ void chip8::displayTest2() {
 	V[0] = 1;
 	V[1] = 1;
 
-	memory[1] = 0xD0;
-	memory[2] = 0x11;
+	storeMemory(1, 0xD0);
+	storeMemory(2, 0x11);
 	emulateCycle();
 
 	//Top Right
 	V[0] = 64;
 	V[1] = 1;
 
-	memory[3] = 0xD0;
-	memory[4] = 0x11;
+	storeMemory(3, 0xD0);
+	storeMemory(4, 0x11);
 	emulateCycle();
 
 	//Bottom Left
 	V[0] = 1;
 	V[1] = 32;
 
-	memory[5] = 0xD0;
-	memory[6] = 0x11;
+	storeMemory(5, 0xD0);
+	storeMemory(6, 0x11);
 	emulateCycle();
 
 	//Bottom Right
 	V[0] = 64;
 	V[1] = 32;
 
-	memory[7] = 0xD0;
-	memory[8] = 0x11;
+	storeMemory(7, 0xD0);
+	storeMemory(8, 0x11);
 	emulateCycle();
 }
 
@@ -1095,8 +1701,8 @@ void chip8::inputTest() {
 	pc = 0;
 	int dummy = 0;
 	while (dummy == 0) {
-		memory[0] = 0xF0;
-		memory[1] = 0x0A;
+		storeMemory(0, 0xF0);
+		storeMemory(1, 0x0A);
 		emulateCycle();
 	}
 }
\ No newline at end of file
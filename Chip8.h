@@ -5,18 +5,81 @@ E-mail: masoumi.mark@gmail.com
 Date: April 6 2020
 */
 
+#pragma once
+
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Quirks.h"
+#include "Display.h"
+#include "CowPages.h"
+#include "StateHash.h"
 
 using namespace std;
 
+const unsigned short BIG_FONT_ADDRESS = 80; //SUPER-CHIP 8x10 digits (FX30) are stored right after the 4x5 font set
+
+const int DISPLAY_PLANES = 4; //XO-CHIP bitplanes. FN01 selects any combination of them, so a pixel has one of 16 colours.
+
+const unsigned CLASSIC_MEMORY_SIZE = 4096; //CHIP-8 and SUPER-CHIP
+const unsigned XO_CHIP_MEMORY_SIZE = 65536; //XO-CHIP
+
+const size_t MEMORY_PAGE_SIZE = 256; //Bytes of memory (and decodedOps) a fork shares or copies as one page
+
+//Interpreter cores runCycles() can run on
+enum interpreterCore {
+	CORE_SWITCH, //Fetch and decode every opcode from memory, like emulateCycle()
+	CORE_PREDECODED, //Decode each address once and fuse common opcode sequences (Predecoded.cpp)
+	CORE_THREADED //Pre-decoded opcodes dispatched with computed gotos on GCC/Clang (Threaded.cpp)
+};
+
+//Copy of the CPU registers, for tools that watch a machine from outside
+struct cpuRegisters {
+	unsigned char V[16];
+	unsigned short I;
+	unsigned short pc;
+	unsigned short stackPointer;
+	unsigned short stack[16];
+	unsigned char delayTimer;
+	unsigned char soundTimer;
+};
+
+//Memory an opcode reads and writes as data. Addresses wrap round the end of memory.
+struct memoryAccess {
+	unsigned readFirst = 0;
+	unsigned readCount = 0;
+	unsigned writeFirst = 0;
+	unsigned writeCount = 0;
+};
+
+//The cached decoding of the opcode at one address (Predecoded.cpp)
+struct decodedOp {
+	unsigned char op; //Which instruction it is. 0 until the address has been decoded.
+	unsigned char fused; //Superinstruction starting at this address, 0 for none
+	unsigned char x;
+	unsigned char y;
+	unsigned char n;
+	unsigned char kk;
+	unsigned short nnn; //The full 16-bit address for XO-CHIP F000 NNNN
+	const void* handler; //Threaded core: the label to jump to for this address
+};
+
 class chip8 {
 	//Member Variables:
 	
 	//Store C8 opcodes as Short (2 Bytes)
 	unsigned short opcode;
 
-	//C8 has 4K memory. 1K = 1024 Bytes. 4K = 4096 Bytes. Char = 1 Byte.
-	unsigned char memory[4096] = { 0 };
+	//C8 has 4K memory. 1K = 1024 Bytes. 4K = 4096 Bytes. Char = 1 Byte. XO-CHIP has 64K, so the size is chosen per machine.
+	//Pages are shared with forks of the machine until one side writes to them (see CowPages.h).
+	cowPages<unsigned char, MEMORY_PAGE_SIZE> memory;
+
+	//memory.size() - 1. Every address is wrapped with it.
+	unsigned short memoryMask = CLASSIC_MEMORY_SIZE - 1;
+
+	//XO-CHIP mode: 64K memory and the XO-CHIP opcodes. Classic ROMs see exactly the CHIP-8 / SUPER-CHIP instruction set.
+	bool xoChip = false;
 
 	//C8 has 16 general-purpose, 8-bit registers referred to to as V0 to VF.
 	unsigned char V[16] = { 0 };
@@ -27,8 +90,26 @@ class chip8 {
 	//Program Counter register
 	unsigned short pc;
 
-	//C8 screen has 2048 pixels (64 x 32). Create a Char array to hold each pixel
-	unsigned char gfx[2048] = { 0 };
+	//C8 screen has 2048 pixels (64 x 32), the SUPER-CHIP hi-res screen 8192 (128 x 64). Each row is packed in to 128 bits (see Display.h).
+	//XO-CHIP adds bitplanes, each one a complete packed screen of its own. Each plane is one copy-on-write page of 64 rows.
+	cowPages<displayRow, 64> gfx;
+
+	//XOR of memoryKey() over all of memory and of rowKey() over all of gfx (StateHash.h), kept up to date by every write
+	unsigned long long memoryHash = 0;
+	unsigned long long displayHash = 0;
+
+	//XO-CHIP: the bitplanes drawing, clearing and scrolling work on (bit 0 = plane 0). CHIP-8 only ever uses plane 0.
+	unsigned char planeMask = 1;
+
+	//XO-CHIP audio: a 1-bit, 128 sample pattern (F002) played at 4000 * 2 ^ ((pitch - 64) / 48) samples per second (FX3A)
+	unsigned char audioPattern[16] = { 0 };
+	unsigned char audioPitch = 64;
+
+	//SUPER-CHIP hi-res (128 x 64) mode, switched by 00FF and 00FE
+	bool hires = false;
+
+	//SUPER-CHIP "RPL user flags" saved by FX75 and restored by FX85. Like on the HP48 they survive initialize().
+	unsigned char rplFlags[16] = { 0 };
 
 	//Delay Timer Register
 	unsigned char delay_timer;
@@ -42,8 +123,122 @@ class chip8 {
 	//Stack (memory stack) Register. C8 has a stack size of 16, each memory location is 16 bits (2 Bytes).
 	unsigned short stack[16] = { 0 };
 
-	//Random Device object for generating random numbers
-	random_device randDevice;
+	//Random number engine for CXKK. Seeded from random_device, or by seedRandom() for a repeatable run.
+	minstd_rand randEngine;
+
+	//Quirk set the machine is currently running with
+	unsigned quirkSet = QUIRKS_DEFAULT;
+
+	//The executeCycle() specialization for quirkSet. emulateCycle() calls through this pointer.
+	typedef void (chip8::*cycleFunction)();
+	cycleFunction cycle;
+
+	template <typename Quirks>
+	void executeCycle(); //Fetch, decode and execute one opcode with the behaviours chosen by Quirks
+
+	template <size_t... Flags>
+	static const cycleFunction* cycleTable(index_sequence<Flags...>); //One executeCycle() per quirk set
+
+	//Core and quirk specialization used by runCycles()
+	interpreterCore core = CORE_SWITCH;
+	typedef void (chip8::*runFunction)(int);
+	runFunction run;
+
+	template <typename Quirks>
+	void runSwitch(int cycles); //Run cycles opcodes through executeCycle()
+
+	template <typename Quirks>
+	void runPredecoded(int cycles); //Run cycles opcodes from the decoded array
+
+	template <typename Quirks>
+	void runThreaded(int cycles); //Run cycles opcodes by jumping from handler to handler through decoded[].handler
+
+	template <size_t... Flags>
+	static const runFunction* switchTable(index_sequence<Flags...>);
+
+	template <size_t... Flags>
+	static const runFunction* predecodedTable(index_sequence<Flags...>);
+
+	template <size_t... Flags>
+	static const runFunction* threadedTable(index_sequence<Flags...>);
+
+	static const runFunction* switchCores(); //runSwitch() for every quirk set, indexed by the quirk flags
+	static const runFunction* predecodedCores(); //runPredecoded() for every quirk set, indexed by the quirk flags
+	static const runFunction* threadedCores(); //runThreaded() for every quirk set, indexed by the quirk flags
+
+	//Decoded opcode for every address, filled in the first time each address is executed. Shared with forks like memory.
+	cowPages<decodedOp, MEMORY_PAGE_SIZE> decoded;
+
+	//The threaded core's "not decoded yet" label, which every stale decodedOp::handler points at.
+	//nullptr whenever the handlers belong to another core or quirk set and must all be reset.
+	const void* threadedMiss = nullptr;
+
+	void decode(unsigned short address); //Decode the opcode at address, fusing it with the opcodes after it where possible
+
+	void clearDecoded(); //Forget every decoded opcode after memory was rewritten
+
+	//Every instruction that writes memory goes through here, so decodings of the changed byte are dropped.
+	//A superinstruction covers up to 6 bytes, so the five addresses before it are dropped too.
+	//Decodings that are already clear are left alone, so writing data never copies a page of decoded[].
+	void storeMemory(unsigned short address, unsigned char value) {
+		address &= memoryMask;
+		unsigned char& byte = memory.writable(address);
+		memoryHash ^= memoryKey(address, byte) ^ memoryKey(address, value);
+		byte = value;
+		for (int i = 0; i < 6 && i <= address; i++) {
+			if (decoded[address - i].op != 0 || decoded[address - i].handler != threadedMiss) {
+				decodedOp& stale = decoded.writable(address - i);
+				stale.op = 0;
+				stale.handler = threadedMiss;
+			}
+		}
+	}
+
+	//Every write to a display row goes through here (or replaces all of gfx), so displayHash follows the screen
+	void storeRow(displayRow* rows, int plane, int line, displayRow value) {
+		displayHash ^= rowKey(plane * 64 + line, rows[line]) ^ rowKey(plane * 64 + line, value);
+		rows[line] = value;
+	}
+
+	template <typename Quirks>
+	friend struct chip8Ops;
+
+	template <bool Clip>
+	void drawSprite(unsigned char xCoord, unsigned char yCoord, int height); //DXYN: XOR a sprite from memory[I] on to the screen, set VF on collision. DXY0 draws 16x16.
+
+	void clearScreen(); //00E0: Clear every pixel
+
+	void scrollDown(int lines); //00CN: Move the picture down, blank lines come in at the top
+
+	void scrollRight(); //00FB: Move the picture 4 pixels right
+
+	void scrollLeft(); //00FC: Move the picture 4 pixels left
+
+	void setHires(bool enabled); //00FF / 00FE: Switch resolution. The screen is cleared.
+
+	void scrollUp(int lines); //00DN: Move the picture up, blank lines come in at the bottom (XO-CHIP)
+
+	void saveRange(int first, int last); //5XY2: Store Vx through Vy (in either direction) in memory starting at I (XO-CHIP)
+
+	void loadRange(int first, int last); //5XY3: Read Vx through Vy (in either direction) from memory starting at I (XO-CHIP)
+
+	void loadAudioPattern(); //F002: Copy 16 bytes from memory[I] in to the audio pattern buffer (XO-CHIP)
+
+	//Bytes a taken skip moves pc forward. XO-CHIP skips the whole of a 4-byte F000 NNNN.
+	unsigned short skipLength() const {
+		return (xoChip && memory[(pc + 2) & memoryMask] == 0xF0 && memory[(pc + 3) & memoryMask] == 0x00) ? 6 : 4;
+	}
+
+	unsigned char randomByte(); //Random number between 0 and 255 for CXKK
+
+	//Recompiled ROMs (Aot.h) run directly on the machine state
+	friend class aotRunner;
+	friend class aotRuntime;
+
+	//So do the debugger (Debug.h), the tracer (Trace.h) and the input latency probe (Latency.h)
+	friend class debugger;
+	friend class tracer;
+	friend class inputLatency;
 
 public:
 
@@ -53,12 +248,70 @@ public:
 	
 	//Member Functions:
 
+	chip8(); //Starts out with the default quirk set
+
 	void initialize(); //Initialize CPU registers and memory once
 
+	void setXoChip(bool enabled); //Switch between the classic machine and XO-CHIP. Memory is resized and cleared, so call initialize() after.
+
+	bool isXoChip() const; //True in XO-CHIP mode
+
 	void loadGame(string); //Load an external file (ROM) in to memory array
+
+	void loadProgram(const unsigned char* program, size_t size); //Copy a ROM already in memory to 0x200
+
+	void seedRandom(unsigned seed); //Make CXKK produce the same numbers on every run with this seed
 	
 	void emulateCycle(); //Emulate one single cycle of CPU (Fetch, Decode, Execute)
 
+	void setQuirks(unsigned flags); //Switch the interpreter to the specialization for a quirk set (see Quirks.h)
+
+	unsigned getQuirks() const; //The quirk set currently in use
+
+	void setCore(interpreterCore newCore); //Choose the interpreter core runCycles() uses
+
+	interpreterCore getCore() const; //The core runCycles() uses
+
+	void runCycles(int cycles); //Emulate cycles opcodes on the current core
+
+	unsigned char readMemory(unsigned short address) const; //Read one byte of the memory array
+
+	unsigned short nextOpcode() const; //The opcode at pc, which the next cycle will execute
+
+	memoryAccess nextAccess() const; //Memory nextOpcode() will read and write, not counting the fetch itself
+
+	//Waiting on FX0A with no key held and both timers run down: nothing will change until a key is pressed
+	bool idle() const;
+
+	int displayWidth() const; //64, or 128 in SUPER-CHIP hi-res mode
+
+	int displayHeight() const; //32, or 64 in SUPER-CHIP hi-res mode
+
+	bool getPixel(int x, int y) const; //True if the pixel at (x, y) is lit in any plane
+
+	int getPixelColor(int x, int y) const; //Bit p set if the pixel at (x, y) is lit in plane p. 0 is the background colour.
+
+	const displayRow* displayRows(int plane = 0) const; //One packed plane of the display, one row per line (displayHeight() rows are in use)
+
+	const unsigned char* getAudioPattern() const; //The 16 byte XO-CHIP audio pattern
+
+	unsigned char getAudioPitch() const; //The XO-CHIP pitch register, 64 = 4000 samples per second
+
+	unsigned char getSoundTimer() const; //Frames the buzzer has left to sound
+
+	cpuRegisters getRegisters() const; //V0-VF, I, pc, the stack and both timers
+
+	//A copy of the machine that shares memory, decodings and display planes with this one, page by page, until either of
+	//them writes to a page. Costs about as much as copying the registers. Copying a chip8 does the same.
+	chip8 fork() const;
+
+	size_t unsharedBytes() const; //Memory, decoding and display bytes this machine does not share with any fork
+
+	//64-bit hash of the whole machine: memory, registers, stack, timers, the display and the XO-CHIP audio state.
+	//Memory and display are hashed incrementally as they are written, so this only hashes the registers. Equal states always
+	//hash equal; the quirk set, the core and the random engine are not part of the state.
+	unsigned long long stateHash() const;
+
 	void drawPixels(); //Sets / plots the pixels to be rendered by renderPixels()
 
 	void decreaseTimers(); //Decrements delay_timer and sound_timer
@@ -0,0 +1,488 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+The instructions of the pre-decoded cores, one small inline function each. They work from a decodedOp instead of the raw
+opcode, but otherwise behave exactly like the matching case of executeCycle() for the same Quirks.
+********************************************************************************************************************************/
+
+//decodedOp::op values
+enum decodedOpId : unsigned char {
+	OP_UNDECODED = 0,
+	OP_CLS, //00E0
+	OP_RET, //00EE
+	OP_STALL, //Opcodes the interpreter does not know. pc stays where it is.
+	OP_JP, //1NNN
+	OP_CALL, //2NNN
+	OP_SE_BYTE, //3XKK
+	OP_SNE_BYTE, //4XKK
+	OP_SE_REG, //5XY0
+	OP_LD_BYTE, //6XKK
+	OP_ADD_BYTE, //7XKK
+	OP_LD_REG, //8XY0
+	OP_OR, //8XY1
+	OP_AND, //8XY2
+	OP_XOR, //8XY3
+	OP_ADD_REG, //8XY4
+	OP_SUB, //8XY5
+	OP_SHR, //8XY6
+	OP_SUBN, //8XY7
+	OP_SHL, //8XYE
+	OP_SNE_REG, //9XY0
+	OP_LD_I, //ANNN
+	OP_JP_V0, //BNNN
+	OP_RND, //CXKK
+	OP_DRW, //DXYN
+	OP_SKP, //EX9E
+	OP_SKNP, //EXA1
+	OP_LD_VX_DT, //FX07
+	OP_LD_KEY, //FX0A
+	OP_LD_DT, //FX15
+	OP_LD_ST, //FX18
+	OP_ADD_I, //FX1E
+	OP_LD_FONT, //FX29
+	OP_BCD, //FX33
+	OP_STORE, //FX55
+	OP_LOAD, //FX65
+	OP_SCD, //00CN
+	OP_SCR, //00FB
+	OP_SCL, //00FC
+	OP_LOW, //00FE
+	OP_HIGH, //00FF
+	OP_LD_BIG_FONT, //FX30
+	OP_SAVE_FLAGS, //FX75
+	OP_LOAD_FLAGS, //FX85
+	OP_SCU, //00DN (XO-CHIP)
+	OP_SAVE_RANGE, //5XY2 (XO-CHIP)
+	OP_LOAD_RANGE, //5XY3 (XO-CHIP)
+	OP_LD_I_LONG, //F000 NNNN (XO-CHIP)
+	OP_PLANE, //FN01 (XO-CHIP)
+	OP_AUDIO, //F002 (XO-CHIP)
+	OP_PITCH, //FX3A (XO-CHIP)
+	OP_COUNT
+};
+
+//decodedOp::fused values: superinstructions replacing a common sequence of 2 or 3 opcodes
+enum fusedOpId : unsigned char {
+	FUSED_NONE = 0,
+	FUSED_LD_LD_DRW, //6XKK; 6YKK; DXYN - position a sprite and draw it
+	FUSED_LD_I_DRW, //ANNN; DXYN - point I at a sprite and draw it
+	FUSED_ADD_SE_JP, //7XKK; 3XKK; 1NNN - counter loop
+	FUSED_LD_DT_SE_JP, //FX07; 3XKK; 1NNN - wait for the delay timer
+	FUSED_COUNT
+};
+
+//Most opcodes each superinstruction runs. It is only used when at least this many cycles are left.
+const int fusedLength[FUSED_COUNT] = { 1, 3, 2, 3, 3 };
+
+
+//Decode one opcode the same way executeCycle() does. The XO-CHIP opcodes are only recognized in XO-CHIP mode.
+//F000 NNNN is 4 bytes long; the caller fills in nnn from the second half.
+inline decodedOp decodeOpcode(unsigned short opcode, bool xoChip) {
+	decodedOp d;
+	d.op = OP_STALL;
+	d.fused = FUSED_NONE;
+	d.x = (opcode & 0x0F00) >> 8;
+	d.y = (opcode & 0x00F0) >> 4;
+	d.n = opcode & 0x000F;
+	d.kk = opcode & 0x00FF;
+	d.nnn = opcode & 0x0FFF;
+	d.handler = nullptr;
+
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		if ((opcode & 0xFFF0) == 0x00C0) d.op = OP_SCD;
+		else if (xoChip && (opcode & 0xFFF0) == 0x00D0) d.op = OP_SCU;
+		else if (opcode == 0x00FB) d.op = OP_SCR;
+		else if (opcode == 0x00FC) d.op = OP_SCL;
+		else if (opcode == 0x00FD) d.op = OP_STALL; //Exit: the program halts
+		else if (opcode == 0x00FE) d.op = OP_LOW;
+		else if (opcode == 0x00FF) d.op = OP_HIGH;
+		else if (d.n == 0x0) d.op = OP_CLS;
+		else if (d.n == 0xE) d.op = OP_RET;
+		break;
+	case 0x1000: d.op = OP_JP; break;
+	case 0x2000: d.op = OP_CALL; break;
+	case 0x3000: d.op = OP_SE_BYTE; break;
+	case 0x4000: d.op = OP_SNE_BYTE; break;
+	case 0x5000:
+		if (xoChip && d.n == 0x2) d.op = OP_SAVE_RANGE;
+		else if (xoChip && d.n == 0x3) d.op = OP_LOAD_RANGE;
+		else d.op = OP_SE_REG;
+		break;
+	case 0x6000: d.op = OP_LD_BYTE; break;
+	case 0x7000: d.op = OP_ADD_BYTE; break;
+	case 0x8000:
+	{
+		static const decodedOpId aluOps[16] = { OP_LD_REG, OP_OR, OP_AND, OP_XOR, OP_ADD_REG, OP_SUB, OP_SHR, OP_SUBN,
+			OP_STALL, OP_STALL, OP_STALL, OP_STALL, OP_STALL, OP_STALL, OP_SHL, OP_STALL };
+		d.op = aluOps[d.n];
+	}
+	break;
+	case 0x9000: d.op = OP_SNE_REG; break;
+	case 0xA000: d.op = OP_LD_I; break;
+	case 0xB000: d.op = OP_JP_V0; break;
+	case 0xC000: d.op = OP_RND; break;
+	case 0xD000: d.op = OP_DRW; break;
+	case 0xE000:
+		if (d.n == 0xE) d.op = OP_SKP;
+		else if (d.n == 0x1) d.op = OP_SKNP;
+		break;
+	case 0xF000:
+		switch (d.n) {
+		case 0x7: d.op = OP_LD_VX_DT; break;
+		case 0xA: d.op = (xoChip && d.y == 0x3) ? OP_PITCH : OP_LD_KEY; break;
+		case 0x8: d.op = OP_LD_ST; break;
+		case 0xE: d.op = OP_ADD_I; break;
+		case 0x9: d.op = OP_LD_FONT; break;
+		case 0x3: d.op = OP_BCD; break;
+		case 0x0:
+			if (xoChip && opcode == 0xF000) d.op = OP_LD_I_LONG;
+			else if (d.y == 0x3) d.op = OP_LD_BIG_FONT;
+			break;
+		case 0x1:
+			if (xoChip && d.y == 0x0) d.op = OP_PLANE;
+			break;
+		case 0x2:
+			if (xoChip && opcode == 0xF002) d.op = OP_AUDIO;
+			break;
+		case 0x5:
+			if (d.y == 0x1) d.op = OP_LD_DT;
+			else if (d.y == 0x5) d.op = OP_STORE;
+			else if (d.y == 0x6) d.op = OP_LOAD;
+			else if (d.y == 0x7) d.op = OP_SAVE_FLAGS;
+			else if (d.y == 0x8) d.op = OP_LOAD_FLAGS;
+			break;
+		}
+		break;
+	}
+
+	return d;
+}
+
+
+template <typename Quirks>
+struct chip8Ops {
+	static void cls(chip8& m, const decodedOp&) {
+		m.clearScreen();
+		m.pc += 2;
+	}
+
+	static void ret(chip8& m, const decodedOp&) {
+		m.stack_pointer--;
+		m.pc = m.stack[m.stack_pointer] + 2;
+	}
+
+	static void jp(chip8& m, const decodedOp& d) {
+		m.pc = d.nnn;
+	}
+
+	static void call(chip8& m, const decodedOp& d) {
+		m.stack[m.stack_pointer] = m.pc;
+		m.stack_pointer++;
+		m.pc = d.nnn;
+	}
+
+	static void seByte(chip8& m, const decodedOp& d) {
+		m.pc += (m.V[d.x] == d.kk) ? m.skipLength() : 2;
+	}
+
+	static void sneByte(chip8& m, const decodedOp& d) {
+		m.pc += (m.V[d.x] != d.kk) ? m.skipLength() : 2;
+	}
+
+	static void seReg(chip8& m, const decodedOp& d) {
+		m.pc += (m.V[d.x] == m.V[d.y]) ? m.skipLength() : 2;
+	}
+
+	static void ldByte(chip8& m, const decodedOp& d) {
+		m.V[d.x] = d.kk;
+		m.pc += 2;
+	}
+
+	static void addByte(chip8& m, const decodedOp& d) {
+		m.V[d.x] += d.kk;
+		m.pc += 2;
+	}
+
+	static void ldReg(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.V[d.y];
+		m.pc += 2;
+	}
+
+	static void logicDone(chip8& m) {
+		if constexpr (Quirks::vfReset) {
+			m.V[0xF] = 0;
+		}
+		m.pc += 2;
+	}
+
+	static void orReg(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.V[d.x] | m.V[d.y];
+		logicDone(m);
+	}
+
+	static void andReg(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.V[d.x] & m.V[d.y];
+		logicDone(m);
+	}
+
+	static void xorReg(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.V[d.x] ^ m.V[d.y];
+		logicDone(m);
+	}
+
+	static void addReg(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.V[d.x] + m.V[d.y];
+		m.V[0xF] = (m.V[d.y] > (0xFF - m.V[d.x])) ? 1 : 0;
+		m.pc += 2;
+	}
+
+	static void sub(chip8& m, const decodedOp& d) {
+		m.V[0xF] = (m.V[d.x] > m.V[d.y]) ? 1 : 0;
+		m.V[d.x] = m.V[d.x] - m.V[d.y];
+		m.pc += 2;
+	}
+
+	static void shr(chip8& m, const decodedOp& d) {
+		unsigned char source = Quirks::shiftVy ? m.V[d.y] : m.V[d.x];
+		m.V[0xF] = source & 1;
+		m.V[d.x] = source >> 1;
+		m.pc += 2;
+	}
+
+	static void subn(chip8& m, const decodedOp& d) {
+		m.V[0xF] = (m.V[d.y] > m.V[d.x]) ? 1 : 0;
+		m.V[d.x] = m.V[d.y] - m.V[d.x];
+		m.pc += 2;
+	}
+
+	static void shl(chip8& m, const decodedOp& d) {
+		unsigned char source = Quirks::shiftVy ? m.V[d.y] : m.V[d.x];
+		m.V[0xF] = source >> 7;
+		m.V[d.x] = source << 1;
+		m.pc += 2;
+	}
+
+	static void sneReg(chip8& m, const decodedOp& d) {
+		m.pc += (m.V[d.x] != m.V[d.y]) ? m.skipLength() : 2;
+	}
+
+	static void ldI(chip8& m, const decodedOp& d) {
+		m.I = d.nnn;
+		m.pc += 2;
+	}
+
+	static void jpV0(chip8& m, const decodedOp& d) {
+		m.pc = d.nnn + (Quirks::jumpVx ? m.V[d.x] : m.V[0]);
+	}
+
+	static void rnd(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.randomByte() & d.kk;
+		m.pc += 2;
+	}
+
+	static void drw(chip8& m, const decodedOp& d) {
+		m.template drawSprite<Quirks::clipSprites>(m.V[d.x], m.V[d.y], d.n);
+		m.pc += 2;
+	}
+
+	static void skp(chip8& m, const decodedOp& d) {
+		m.pc += (m.key[m.V[d.x]] == 1) ? m.skipLength() : 2;
+	}
+
+	static void sknp(chip8& m, const decodedOp& d) {
+		m.pc += (m.key[m.V[d.x]] == 0) ? m.skipLength() : 2;
+	}
+
+	static void ldVxDt(chip8& m, const decodedOp& d) {
+		m.V[d.x] = m.delay_timer;
+		m.pc += 2;
+	}
+
+	static void ldKey(chip8& m, const decodedOp& d) {
+		for (int i = 0; i < 16; i++) {
+			if (m.key[i] == 1) {
+				m.V[d.x] = i;
+				m.pc += 2;
+			}
+		}
+	}
+
+	static void ldDt(chip8& m, const decodedOp& d) {
+		m.delay_timer = m.V[d.x];
+		m.pc += 2;
+	}
+
+	static void ldSt(chip8& m, const decodedOp& d) {
+		m.sound_timer = m.V[d.x];
+		m.pc += 2;
+	}
+
+	static void addI(chip8& m, const decodedOp& d) {
+		m.V[0xF] = (m.I + m.V[d.x] > 0xFFF) ? 1 : 0;
+		m.I += m.V[d.x];
+		m.pc += 2;
+	}
+
+	static void ldFont(chip8& m, const decodedOp& d) {
+		m.I = m.V[d.x] * 5;
+		m.pc += 2;
+	}
+
+	//Stores can move the page d lives in (see CowPages.h), so the ops that store read d before the first one
+	static void bcd(chip8& m, const decodedOp& d) {
+		unsigned char value = m.V[d.x];
+		m.storeMemory(m.I, value / 100);
+		m.storeMemory(m.I + 1, (value / 10) % 10);
+		m.storeMemory(m.I + 2, value % 10);
+		m.pc += 2;
+	}
+
+	static void store(chip8& m, const decodedOp& d) {
+		int last = d.x;
+		for (int j = 0; j <= last; j++) {
+			m.storeMemory(m.I + j, m.V[j]);
+		}
+		if constexpr (Quirks::loadStoreIncrementsI) {
+			m.I += last + 1;
+		}
+		m.pc += 2;
+	}
+
+	static void load(chip8& m, const decodedOp& d) {
+		for (int j = 0; j <= d.x; j++) {
+			m.V[j] = m.memory[(m.I + j) & m.memoryMask];
+		}
+		if constexpr (Quirks::loadStoreIncrementsI) {
+			m.I += d.x + 1;
+		}
+		m.pc += 2;
+	}
+
+	static void scd(chip8& m, const decodedOp& d) {
+		m.scrollDown(d.n);
+		m.pc += 2;
+	}
+
+	static void scr(chip8& m, const decodedOp&) {
+		m.scrollRight();
+		m.pc += 2;
+	}
+
+	static void scl(chip8& m, const decodedOp&) {
+		m.scrollLeft();
+		m.pc += 2;
+	}
+
+	static void low(chip8& m, const decodedOp&) {
+		m.setHires(false);
+		m.pc += 2;
+	}
+
+	static void high(chip8& m, const decodedOp&) {
+		m.setHires(true);
+		m.pc += 2;
+	}
+
+	static void ldBigFont(chip8& m, const decodedOp& d) {
+		m.I = BIG_FONT_ADDRESS + (m.V[d.x] & 0xF) * 10;
+		m.pc += 2;
+	}
+
+	static void saveFlags(chip8& m, const decodedOp& d) {
+		for (int j = 0; j <= d.x; j++) {
+			m.rplFlags[j] = m.V[j];
+		}
+		m.pc += 2;
+	}
+
+	static void loadFlags(chip8& m, const decodedOp& d) {
+		for (int j = 0; j <= d.x; j++) {
+			m.V[j] = m.rplFlags[j];
+		}
+		m.pc += 2;
+	}
+
+	static void scu(chip8& m, const decodedOp& d) {
+		m.scrollUp(d.n);
+		m.pc += 2;
+	}
+
+	static void saveRange(chip8& m, const decodedOp& d) {
+		m.saveRange(d.x, d.y);
+		m.pc += 2;
+	}
+
+	static void loadRange(chip8& m, const decodedOp& d) {
+		m.loadRange(d.x, d.y);
+		m.pc += 2;
+	}
+
+	static void ldILong(chip8& m, const decodedOp& d) {
+		m.I = d.nnn;
+		m.pc += 4;
+	}
+
+	static void plane(chip8& m, const decodedOp& d) {
+		m.planeMask = d.x & ((1 << DISPLAY_PLANES) - 1);
+		m.pc += 2;
+	}
+
+	static void audio(chip8& m, const decodedOp&) {
+		m.loadAudioPattern();
+		m.pc += 2;
+	}
+
+	static void pitch(chip8& m, const decodedOp& d) {
+		m.audioPitch = m.V[d.x];
+		m.pc += 2;
+	}
+
+	//Superinstructions. Each one runs its opcodes back to back with no dispatch in between, so every register,
+	//VF and pc ends up exactly as if they had run one at a time. next1 and next2 are the decodings after d.
+	//They return how many opcodes actually ran: a taken skip jumps over the 1NNN, so that costs one cycle less.
+
+	static int ldLdDrw(chip8& m, const decodedOp& d, const decodedOp& next1, const decodedOp& next2) {
+		ldByte(m, d);
+		ldByte(m, next1);
+		drw(m, next2);
+		return 3;
+	}
+
+	static int ldIDrw(chip8& m, const decodedOp& d, const decodedOp& next1) {
+		ldI(m, d);
+		drw(m, next1);
+		return 2;
+	}
+
+	static int addSeJp(chip8& m, const decodedOp& d, const decodedOp& next1, const decodedOp& next2) {
+		m.V[d.x] += d.kk;
+		if (m.V[next1.x] == next1.kk) {
+			m.pc += 6;
+			return 2;
+		}
+		m.pc = next2.nnn;
+		return 3;
+	}
+
+	static int ldDtSeJp(chip8& m, const decodedOp& d, const decodedOp& next1, const decodedOp& next2) {
+		m.V[d.x] = m.delay_timer;
+		if (m.V[next1.x] == next1.kk) {
+			m.pc += 6;
+			return 2;
+		}
+		m.pc = next2.nnn;
+		return 3;
+	}
+};
@@ -0,0 +1,73 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Lock-free set of 64-bit hashes (state hashes, see StateHash.h) that many threads can insert in to at once.
+
+Open addressing with linear probing in one fixed array: a key is claimed with a single compare-and-swap on an empty slot, so
+no thread ever waits for another. The keys are hashes already, so their low bits pick the first slot. 0 marks an empty slot,
+and a key of 0 is stored as 1. The set never grows; the owner checks full() and stops inserting before probes get long.
+********************************************************************************************************************************/
+
+class concurrentHashSet {
+	unique_ptr<atomic<unsigned long long>[]> slots;
+	size_t mask;
+	atomic<size_t> count{ 0 };
+
+public:
+	//Room for at least capacity keys (rounded up to a power of 2)
+	explicit concurrentHashSet(size_t capacity) {
+		size_t size = 1024;
+		while (size < capacity) {
+			size *= 2;
+		}
+		slots.reset(new atomic<unsigned long long>[size]);
+		for (size_t i = 0; i < size; i++) {
+			slots[i].store(0, memory_order_relaxed);
+		}
+		mask = size - 1;
+	}
+
+	//True if key was not in the set yet. Of several threads inserting the same key, exactly one gets true.
+	bool insert(unsigned long long key) {
+		if (key == 0) {
+			key = 1;
+		}
+
+		for (size_t i = key & mask; ; i = (i + 1) & mask) {
+			unsigned long long seen = slots[i].load(memory_order_relaxed);
+			if (seen == 0 && slots[i].compare_exchange_strong(seen, key, memory_order_relaxed)) {
+				count.fetch_add(1, memory_order_relaxed);
+				return true;
+			}
+			if (seen == key) {
+				return false;
+			}
+		}
+	}
+
+	size_t size() const {
+		return count.load(memory_order_relaxed);
+	}
+
+	size_t capacity() const {
+		return mask + 1;
+	}
+
+	//Three quarters used: past this, probe sequences grow quickly
+	bool full() const {
+		return size() >= capacity() / 4 * 3;
+	}
+};
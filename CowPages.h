@@ -0,0 +1,171 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Copy-on-write array. The items live in fixed-size pages, and a page table points at them. Copying the array shares the page
+table. The first write after a copy gives the writer its own page table (sharing the pages it points at), and the first
+write to each page gives the writer its own copy of that page. A copy therefore costs one reference count up front, and after
+that one page per page that actually changes.
+
+Reads go through operator[], which is const and never copies. Writes go through writable() or writablePage(). A reference
+those return stays valid until the next write to another page of the same array.
+
+Copies may be used on different threads; each one must only be used by one thread at a time.
+********************************************************************************************************************************/
+
+template <typename T, size_t PageSize>
+class cowPages {
+	struct block {
+		atomic<unsigned> references;
+		T items[PageSize];
+	};
+
+	struct table {
+		atomic<unsigned> references;
+		size_t count;
+		block* pages[1]; //count entries
+	};
+
+	table* pages = nullptr;
+
+	static table* newTable(size_t count) {
+		table* created = (table*)::operator new(sizeof(table) + (count > 0 ? count - 1 : 0) * sizeof(block*));
+		new (&created->references) atomic<unsigned>(1);
+		created->count = count;
+		return created;
+	}
+
+	static void release(block* shared) {
+		if (shared->references.fetch_sub(1, memory_order_acq_rel) == 1) {
+			delete shared;
+		}
+	}
+
+	static void release(table* shared) {
+		if (shared != nullptr && shared->references.fetch_sub(1, memory_order_acq_rel) == 1) {
+			for (size_t p = 0; p < shared->count; p++) {
+				release(shared->pages[p]);
+			}
+			::operator delete(shared);
+		}
+	}
+
+	//Give this array its own page table, still pointing at the shared pages
+	void unshareTable() {
+		table* copy = newTable(pages->count);
+		for (size_t p = 0; p < pages->count; p++) {
+			copy->pages[p] = pages->pages[p];
+			copy->pages[p]->references.fetch_add(1, memory_order_relaxed);
+		}
+		release(pages);
+		pages = copy;
+	}
+
+	//Give this array its own copy of page p
+	void unsharePage(size_t p) {
+		block* copy = new block;
+		copy->references.store(1, memory_order_relaxed);
+		for (size_t i = 0; i < PageSize; i++) {
+			copy->items[i] = pages->pages[p]->items[i];
+		}
+		release(pages->pages[p]);
+		pages->pages[p] = copy;
+	}
+
+public:
+	cowPages() = default;
+
+	cowPages(const cowPages& other) : pages(other.pages) {
+		if (pages != nullptr) {
+			pages->references.fetch_add(1, memory_order_relaxed);
+		}
+	}
+
+	cowPages& operator=(const cowPages& other) {
+		cowPages copy(other);
+		swap(pages, copy.pages);
+		return *this;
+	}
+
+	~cowPages() {
+		release(pages);
+	}
+
+	//size items (rounded up to whole pages), all set to value, none of them shared. Pages this array already has to itself
+	//are overwritten in place when the size stays the same; shared pages are dropped for fresh ones rather than copied.
+	void assign(size_t size, const T& value) {
+		size_t count = (size + PageSize - 1) / PageSize;
+
+		if (pages == nullptr || pages->count != count || pages->references.load(memory_order_acquire) != 1) {
+			release(pages);
+			pages = newTable(count);
+			for (size_t p = 0; p < count; p++) {
+				pages->pages[p] = nullptr;
+			}
+		}
+
+		for (size_t p = 0; p < count; p++) {
+			block*& page = pages->pages[p];
+			if (page != nullptr && page->references.load(memory_order_acquire) != 1) {
+				release(page);
+				page = nullptr;
+			}
+			if (page == nullptr) {
+				page = new block;
+				page->references.store(1, memory_order_relaxed);
+			}
+			for (size_t i = 0; i < PageSize; i++) {
+				page->items[i] = value;
+			}
+		}
+	}
+
+	size_t size() const {
+		return pages != nullptr ? pages->count * PageSize : 0;
+	}
+
+	const T& operator[](size_t index) const {
+		return pages->pages[index / PageSize]->items[index % PageSize];
+	}
+
+	T& writable(size_t index) {
+		return writablePage(index / PageSize)[index % PageSize];
+	}
+
+	const T* page(size_t p) const {
+		return pages->pages[p]->items;
+	}
+
+	T* writablePage(size_t p) {
+		if (pages->references.load(memory_order_acquire) != 1) {
+			unshareTable();
+		}
+		if (pages->pages[p]->references.load(memory_order_acquire) != 1) {
+			unsharePage(p);
+		}
+		return pages->pages[p]->items;
+	}
+
+	//Bytes of the pages no other copy shares
+	size_t unsharedBytes() const {
+		size_t bytes = 0;
+		for (size_t p = 0; pages != nullptr && pages->references.load(memory_order_relaxed) == 1 && p < pages->count; p++) {
+			if (pages->pages[p]->references.load(memory_order_relaxed) == 1) {
+				bytes += sizeof(T) * PageSize;
+			}
+		}
+		return bytes;
+	}
+};
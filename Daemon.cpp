@@ -0,0 +1,381 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Emulation daemon: hosts headless machines for other processes over a Unix domain socket (protocol in DaemonProtocol.h).
+
+Usage: Daemon <socket path> [ROM directory] [threads]
+
+Each connection is served by its own thread. The requests it sends are read in as large chunks as the socket gives, and
+the answers to every complete request in a chunk are sent back in one write, so a client that pipelines its requests pays
+for the system calls once per batch rather than once per request. The instances of a step request are spread over one
+shared worker pool (default: one thread per core).
+
+	g++ -std=c++17 -O2 -DCHIP8_HEADLESS Daemon.cpp WorkerPool.cpp Chip8.cpp Quirks.cpp RomLibrary.cpp RomAnalysis.cpp
+		Predecoded.cpp Threaded.cpp -o Daemon -pthread
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "Chip8.h"
+#include "DaemonProtocol.h"
+#include "RomLibrary.h"
+#include "WorkerPool.h"
+
+using namespace std;
+
+string romDirectory = ".";
+unique_ptr<workerPool> pool;
+
+//ROM files by name, each read once (see loadCachedRom())
+map<string, shared_ptr<const vector<unsigned char>>> romCache;
+mutex romCacheLock;
+
+//One machine owned by a connection
+struct instance {
+	chip8 machine;
+	shared_ptr<const vector<unsigned char>> rom;
+	unsigned quirks = QUIRKS_DEFAULT;
+	int cyclesPerFrame = DEFAULT_CYCLES_PER_FRAME; //The ROM library's rate, for step requests that leave it at 0
+	bool xoChip = false;
+	unsigned long long lastStep = 0; //Step request that last included it, to catch an id listed twice
+	vector<unsigned char> output; //This instance's part of the step response, written by the worker that stepped it
+};
+
+//State of one client connection
+struct session {
+	int socket;
+	unordered_map<unsigned, unique_ptr<instance>> instances;
+	unsigned nextId = 1;
+	unsigned long long steps = 0;
+	vector<instance*> stepping; //Instances of the step request being served
+};
+
+void serve(int socket);
+
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		cout << "Usage: Daemon <socket path> [ROM directory] [threads]" << endl;
+		return 1;
+	}
+
+	if (argc > 2) {
+		romDirectory = argv[2];
+	}
+	pool.reset(argc > 3 ? new workerPool(max(1, atoi(argv[3]))) : new workerPool());
+
+	//A client that goes away mid-response must not take the daemon down with it
+	signal(SIGPIPE, SIG_IGN);
+
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (strlen(argv[1]) >= sizeof(address.sun_path)) {
+		cout << "The socket path is too long" << endl;
+		return 1;
+	}
+	strcpy(address.sun_path, argv[1]);
+
+	int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(argv[1]);
+	if (listener < 0 || bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 16) != 0) {
+		cout << "Could not listen on " << argv[1] << endl;
+		return 1;
+	}
+
+	cout << "Listening on " << argv[1] << " with " << pool->size() << " threads" << endl;
+
+	while (true) {
+		int client = accept(listener, nullptr, nullptr);
+		if (client >= 0) {
+			thread(serve, client).detach();
+		}
+	}
+}
+
+
+shared_ptr<const vector<unsigned char>> loadCachedRom(const string& name) {
+	//Only plain file names, so a client cannot read outside the ROM directory
+	if (name.empty() || name.find('/') != string::npos || name == "." || name == "..") {
+		return nullptr;
+	}
+
+	lock_guard<mutex> guard(romCacheLock);
+
+	auto cached = romCache.find(name);
+	if (cached != romCache.end()) {
+		return cached->second;
+	}
+
+	ifstream file(romDirectory + "/" + name, ios::in | ios::binary);
+	if (!file) {
+		return nullptr;
+	}
+
+	shared_ptr<const vector<unsigned char>> rom = make_shared<const vector<unsigned char>>(
+		(istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+	romCache[name] = rom;
+	return rom;
+}
+
+
+void startInstance(instance& target) {
+	target.machine.setXoChip(target.xoChip);
+	target.machine.initialize();
+	target.machine.setQuirks(target.quirks);
+	target.machine.setCore(CORE_THREADED);
+	target.machine.loadProgram(target.rom->data(), target.rom->size());
+	memset(target.machine.key, 0, sizeof(target.machine.key));
+}
+
+
+daemonStatus createInstances(session& client, const unsigned char* payload, unsigned length, vector<unsigned char>& response) {
+	if (length < 10 || length != 10u + getU16(payload + 8)) {
+		return STATUS_BAD_REQUEST;
+	}
+
+	unsigned count = getU16(payload);
+	bool xoChip = payload[2] != 0;
+	unsigned quirks = getU32(payload + 4);
+	string name((const char*)payload + 10, getU16(payload + 8));
+
+	shared_ptr<const vector<unsigned char>> rom = loadCachedRom(name);
+	if (!rom) {
+		return STATUS_NO_ROM;
+	}
+
+	int cyclesPerFrame = romInfoFor(rom->data(), rom->size()).cyclesPerFrame;
+
+	unsigned first = client.nextId;
+	for (unsigned i = 0; i < count; i++) {
+		unique_ptr<instance> created(new instance());
+		created->rom = rom;
+		created->xoChip = xoChip;
+		created->cyclesPerFrame = cyclesPerFrame;
+		created->quirks = quirks == QUIRKS_FROM_ROM ? quirksForRom(name) : quirks;
+		startInstance(*created);
+		client.instances[client.nextId++] = move(created);
+	}
+
+	putU32(response, first);
+	putU16(response, (unsigned short)count);
+	return STATUS_OK;
+}
+
+
+//Append the registers in mask and the requested planes of the display
+void writeStepOutput(const chip8& machine, unsigned short flags, unsigned mask, vector<unsigned char>& out) {
+	if (mask != 0) {
+		cpuRegisters registers = machine.getRegisters();
+		for (int x = 0; x < 16; x++) {
+			if (mask & (1 << x)) {
+				out.push_back(registers.V[x]);
+			}
+		}
+		if (mask & REGISTER_I) putU16(out, registers.I);
+		if (mask & REGISTER_PC) putU16(out, registers.pc);
+		if (mask & REGISTER_SP) putU16(out, registers.stackPointer);
+		if (mask & REGISTER_DT) out.push_back(registers.delayTimer);
+		if (mask & REGISTER_ST) out.push_back(registers.soundTimer);
+	}
+
+	if (flags & OUTPUT_FRAMEBUFFER) {
+		out.push_back(machine.displayWidth() == 128 ? 1 : 0);
+
+		int planes = (flags & OUTPUT_ALL_PLANES) ? DISPLAY_PLANES : 1;
+		for (int plane = 0; plane < planes; plane++) {
+			const displayRow* rows = machine.displayRows(plane);
+			for (int y = 0; y < machine.displayHeight(); y++) {
+				for (int i = 0; i < machine.displayWidth() / 8; i++) {
+					out.push_back(rowByte(rows[y], i));
+				}
+			}
+		}
+	}
+}
+
+
+daemonStatus stepInstances(session& client, const unsigned char* payload, unsigned length, vector<unsigned char>& response) {
+	if (length < 14 || length != 14u + getU16(payload + 12) * 6u) {
+		return STATUS_BAD_REQUEST;
+	}
+
+	unsigned frames = getU32(payload);
+	int cyclesPerFrame = getU16(payload + 4); //0: each instance's own rate
+	unsigned short flags = getU16(payload + 6);
+	unsigned mask = getU32(payload + 8);
+	unsigned count = getU16(payload + 12);
+	const unsigned char* entries = payload + 14;
+
+	//Check every id before touching any machine, so a bad request changes nothing
+	unsigned long long step = ++client.steps;
+	client.stepping.clear();
+	for (unsigned k = 0; k < count; k++) {
+		auto found = client.instances.find(getU32(entries + k * 6));
+		if (found == client.instances.end()) {
+			return STATUS_NO_INSTANCE;
+		}
+		if (found->second->lastStep == step) {
+			return STATUS_BAD_REQUEST; //Two workers would run the same machine
+		}
+		found->second->lastStep = step;
+		client.stepping.push_back(found->second.get());
+	}
+
+	pool->forEach(count, [&](size_t k) {
+		instance& target = *client.stepping[k];
+		unsigned short keys = getU16(entries + k * 6 + 4);
+		for (int key = 0; key < 16; key++) {
+			target.machine.key[key] = (keys >> key) & 1;
+		}
+
+		int cycles = cyclesPerFrame != 0 ? cyclesPerFrame : target.cyclesPerFrame;
+		for (unsigned frame = 0; frame < frames; frame++) {
+			target.machine.runCycles(cycles);
+			target.machine.decreaseTimers();
+		}
+
+		target.output.clear();
+		putU32(target.output, getU32(entries + k * 6));
+		writeStepOutput(target.machine, flags, mask, target.output);
+	});
+
+	putU16(response, (unsigned short)count);
+	for (instance* target : client.stepping) {
+		response.insert(response.end(), target->output.begin(), target->output.end());
+	}
+	return STATUS_OK;
+}
+
+
+//REQUEST_RESET and REQUEST_DESTROY
+daemonStatus changeInstances(session& client, bool destroy, const unsigned char* payload, unsigned length) {
+	if (length < 2 || length != 2u + getU16(payload) * 4u) {
+		return STATUS_BAD_REQUEST;
+	}
+
+	unsigned count = getU16(payload);
+	for (unsigned k = 0; k < count; k++) {
+		if (client.instances.count(getU32(payload + 2 + k * 4)) == 0) {
+			return STATUS_NO_INSTANCE;
+		}
+	}
+
+	for (unsigned k = 0; k < count; k++) {
+		unsigned id = getU32(payload + 2 + k * 4);
+		if (destroy) {
+			client.instances.erase(id);
+		}
+		else {
+			startInstance(*client.instances[id]);
+		}
+	}
+
+	return STATUS_OK;
+}
+
+
+//Answer one request, appending the response (header included) to out
+void answer(session& client, const messageHeader& request, const unsigned char* payload, vector<unsigned char>& out) {
+	size_t headerAt = out.size();
+	out.resize(out.size() + MESSAGE_HEADER_SIZE);
+
+	daemonStatus status;
+	switch (request.type) {
+	case REQUEST_CREATE: status = createInstances(client, payload, request.length, out); break;
+	case REQUEST_STEP: status = stepInstances(client, payload, request.length, out); break;
+	case REQUEST_RESET: status = changeInstances(client, false, payload, request.length); break;
+	case REQUEST_DESTROY: status = changeInstances(client, true, payload, request.length); break;
+	default: status = STATUS_BAD_REQUEST; break;
+	}
+
+	//Failed requests carry no payload
+	if (status != STATUS_OK) {
+		out.resize(headerAt + MESSAGE_HEADER_SIZE);
+	}
+
+	messageHeader response;
+	response.length = (unsigned)(out.size() - headerAt - MESSAGE_HEADER_SIZE);
+	response.type = request.type;
+	response.status = (unsigned char)status;
+	response.tag = request.tag;
+
+	vector<unsigned char> header;
+	putHeader(header, response);
+	memcpy(&out[headerAt], header.data(), MESSAGE_HEADER_SIZE);
+}
+
+
+bool sendAll(int socket, const vector<unsigned char>& data) {
+	size_t sent = 0;
+	while (sent < data.size()) {
+		ssize_t written = send(socket, data.data() + sent, data.size() - sent, 0);
+		if (written <= 0) {
+			return false;
+		}
+		sent += written;
+	}
+	return true;
+}
+
+
+void serve(int socket) {
+	session client;
+	client.socket = socket;
+
+	vector<unsigned char> input; //Bytes received and not yet answered
+	vector<unsigned char> output;
+	size_t used = 0; //Bytes of input already answered
+	vector<unsigned char> chunk(65536);
+
+	while (true) {
+		//Answer every complete request that has arrived, then send all the answers at once
+		output.clear();
+		while (input.size() - used >= (size_t)MESSAGE_HEADER_SIZE) {
+			messageHeader request = getHeader(&input[used]);
+			if (request.length > MAX_MESSAGE_LENGTH) {
+				close(socket);
+				return;
+			}
+			if (input.size() - used < MESSAGE_HEADER_SIZE + request.length) {
+				break;
+			}
+
+			answer(client, request, &input[used] + MESSAGE_HEADER_SIZE, output);
+			used += MESSAGE_HEADER_SIZE + request.length;
+		}
+
+		if (!output.empty() && !sendAll(socket, output)) {
+			break;
+		}
+
+		input.erase(input.begin(), input.begin() + used);
+		used = 0;
+
+		ssize_t received = recv(socket, chunk.data(), chunk.size(), 0);
+		if (received <= 0) {
+			break;
+		}
+		input.insert(input.end(), chunk.begin(), chunk.begin() + received);
+	}
+
+	close(socket);
+}
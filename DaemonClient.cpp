@@ -0,0 +1,138 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "DaemonClient.h"
+
+using namespace std;
+
+
+daemonClient::~daemonClient() {
+	if (socket >= 0) {
+		close(socket);
+	}
+}
+
+
+bool daemonClient::connect(const string& socketPath) {
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path)) {
+		return false;
+	}
+	strcpy(address.sun_path, socketPath.c_str());
+
+	socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socket < 0 || ::connect(socket, (sockaddr*)&address, sizeof(address)) != 0) {
+		if (socket >= 0) {
+			close(socket);
+		}
+		socket = -1;
+		return false;
+	}
+
+	return true;
+}
+
+
+unsigned daemonClient::send(daemonRequest type, const vector<unsigned char>& payload) {
+	messageHeader header;
+	header.length = (unsigned)payload.size();
+	header.type = (unsigned char)type;
+	header.tag = nextTag++;
+
+	putHeader(pending, header);
+	pending.insert(pending.end(), payload.begin(), payload.end());
+	return header.tag;
+}
+
+
+bool daemonClient::flush() {
+	size_t sent = 0;
+	while (sent < pending.size()) {
+		ssize_t written = ::send(socket, pending.data() + sent, pending.size() - sent, 0);
+		if (written <= 0) {
+			return false;
+		}
+		sent += written;
+	}
+
+	pending.clear();
+	return true;
+}
+
+
+bool daemonClient::receive(messageHeader& header, vector<unsigned char>& payload) {
+	if (!pending.empty() && !flush()) {
+		return false;
+	}
+
+	unsigned char chunk[65536];
+	while (true) {
+		if (input.size() - used >= (size_t)MESSAGE_HEADER_SIZE) {
+			header = getHeader(&input[used]);
+			if (input.size() - used >= MESSAGE_HEADER_SIZE + header.length) {
+				const unsigned char* start = &input[used] + MESSAGE_HEADER_SIZE;
+				payload.assign(start, start + header.length);
+				used += MESSAGE_HEADER_SIZE + header.length;
+				return true;
+			}
+		}
+
+		input.erase(input.begin(), input.begin() + used);
+		used = 0;
+
+		ssize_t received = recv(socket, chunk, sizeof(chunk), 0);
+		if (received <= 0) {
+			return false;
+		}
+		input.insert(input.end(), chunk, chunk + received);
+	}
+}
+
+
+unsigned daemonClient::create(const string& rom, int count, bool xoChip, unsigned quirks) {
+	vector<unsigned char> payload;
+	putU16(payload, (unsigned short)count);
+	payload.push_back(xoChip ? 1 : 0);
+	payload.push_back(0);
+	putU32(payload, quirks);
+	putU16(payload, (unsigned short)rom.size());
+	payload.insert(payload.end(), rom.begin(), rom.end());
+
+	unsigned tag = send(REQUEST_CREATE, payload);
+
+	messageHeader header;
+	vector<unsigned char> response;
+	while (receive(header, response)) {
+		if (header.tag == tag) {
+			return (header.status == STATUS_OK && response.size() >= 4) ? getU32(response.data()) : 0;
+		}
+	}
+	return 0;
+}
+
+
+vector<unsigned char> stepPayload(unsigned frames, unsigned short flags, unsigned registerMask, const vector<unsigned>& ids,
+	const vector<unsigned short>& keys, unsigned short cyclesPerFrame) {
+	vector<unsigned char> payload;
+	putU32(payload, frames);
+	putU16(payload, cyclesPerFrame);
+	putU16(payload, flags);
+	putU32(payload, registerMask);
+	putU16(payload, (unsigned short)ids.size());
+
+	for (size_t k = 0; k < ids.size(); k++) {
+		putU32(payload, ids[k]);
+		putU16(payload, k < keys.size() ? keys[k] : 0);
+	}
+
+	return payload;
+}
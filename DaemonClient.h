@@ -0,0 +1,51 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "DaemonProtocol.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Client side of the daemon protocol (DaemonProtocol.h). send() only queues a request; the queued requests go out together on
+flush() or on the next receive(), so a caller can pipeline a batch of requests in one write and then collect the answers in
+order.
+********************************************************************************************************************************/
+
+class daemonClient {
+	int socket = -1;
+	unsigned nextTag = 1;
+	vector<unsigned char> pending; //Requests not sent yet
+	vector<unsigned char> input; //Bytes received and not yet returned
+	size_t used = 0;
+
+public:
+	daemonClient() = default;
+
+	~daemonClient();
+
+	daemonClient(const daemonClient&) = delete;
+	daemonClient& operator=(const daemonClient&) = delete;
+
+	bool connect(const string& socketPath); //False if no daemon listens there
+
+	unsigned send(daemonRequest type, const vector<unsigned char>& payload); //Queue a request. Returns its tag.
+
+	bool flush(); //Send every queued request
+
+	bool receive(messageHeader& header, vector<unsigned char>& payload); //Next response, in request order. False if the daemon went away.
+
+	//Create count instances of a ROM and wait for the answer. Returns the first id, 0 on failure.
+	unsigned create(const string& rom, int count, bool xoChip = false, unsigned quirks = QUIRKS_FROM_ROM);
+};
+
+//Payload of a step request for ids, all held for frames frames with the matching keys
+vector<unsigned char> stepPayload(unsigned frames, unsigned short flags, unsigned registerMask, const vector<unsigned>& ids,
+	const vector<unsigned short>& keys, unsigned short cyclesPerFrame = 0);
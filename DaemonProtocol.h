@@ -0,0 +1,115 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Wire protocol of the emulation daemon (Daemon.cpp), spoken over a Unix domain stream socket. All integers are little-endian.
+
+Every message, in either direction, is a 12 byte header followed by the payload:
+	length     4 bytes, payload size in bytes
+	type       1 byte, a daemonRequest. Responses repeat the request's type.
+	status     1 byte, 0 in requests, a daemonStatus in responses
+	reserved   2 bytes, 0
+	tag        4 bytes, chosen by the client and copied in to the response
+
+Requests on one connection are answered in order, and a client may send as many as it likes before reading the answers.
+Instances belong to the connection that created them and are destroyed when it closes.
+
+REQUEST_CREATE   count (2), xoChip (1), 0 (1), quirks (4, QUIRKS_FROM_ROM for the ROM's own set), name length (2), ROM name
+	-> first id (4), count (2). The new instances are numbered first id, first id + 1, ...
+	ROMs are read from the daemon's ROM directory the first time they are named and served from memory after that.
+REQUEST_STEP     frames (4), cycles per frame (2, 0 = the ROM library's rate for the ROM), output flags (2), register mask (4),
+                 count (2), then count times: id (4), keys (2, bit k = key k held for the whole step)
+	-> count (2), then for each instance, in request order:
+		id (4)
+		the registers in the mask, in bit order: V0-VF 1 byte each, I, PC and SP 2 bytes each, DT and ST 1 byte each
+		with OUTPUT_FRAMEBUFFER: hires (1), then every row of plane 0 (or of all planes with OUTPUT_ALL_PLANES),
+			8 pixels per byte, MSB first: 32 rows of 8 bytes, or 64 rows of 16 bytes in hi-res
+	Each frame runs the cycles and then ticks the timers once, like the windowed emulator.
+	The instances are stepped in parallel on the daemon's worker threads.
+REQUEST_RESET    count (2), then count ids (4 each) -> empty. The instances restart their ROMs.
+REQUEST_DESTROY  count (2), then count ids (4 each) -> empty
+********************************************************************************************************************************/
+
+const int MESSAGE_HEADER_SIZE = 12;
+
+const unsigned MAX_MESSAGE_LENGTH = 64 << 20; //Anything longer is treated as a broken stream
+
+const unsigned QUIRKS_FROM_ROM = 0xFFFFFFFF;
+
+enum daemonRequest {
+	REQUEST_CREATE = 1,
+	REQUEST_STEP = 2,
+	REQUEST_RESET = 3,
+	REQUEST_DESTROY = 4
+};
+
+enum daemonStatus {
+	STATUS_OK = 0,
+	STATUS_BAD_REQUEST = 1, //Unknown type or malformed payload
+	STATUS_NO_ROM = 2, //The ROM file could not be read
+	STATUS_NO_INSTANCE = 3 //An id is not an instance of this connection. Nothing was stepped, reset or destroyed.
+};
+
+//REQUEST_STEP output flags
+const unsigned short OUTPUT_FRAMEBUFFER = 1;
+const unsigned short OUTPUT_ALL_PLANES = 2;
+
+//REQUEST_STEP register mask bits. Bits 0-15 select V0-VF.
+const unsigned REGISTER_I = 1 << 16;
+const unsigned REGISTER_PC = 1 << 17;
+const unsigned REGISTER_SP = 1 << 18;
+const unsigned REGISTER_DT = 1 << 19;
+const unsigned REGISTER_ST = 1 << 20;
+
+struct messageHeader {
+	unsigned length = 0;
+	unsigned char type = 0;
+	unsigned char status = 0;
+	unsigned tag = 0;
+};
+
+inline void putU16(vector<unsigned char>& out, unsigned short value) {
+	out.push_back((unsigned char)value);
+	out.push_back((unsigned char)(value >> 8));
+}
+
+inline void putU32(vector<unsigned char>& out, unsigned value) {
+	putU16(out, (unsigned short)value);
+	putU16(out, (unsigned short)(value >> 16));
+}
+
+inline unsigned short getU16(const unsigned char* in) {
+	return (unsigned short)(in[0] | (in[1] << 8));
+}
+
+inline unsigned getU32(const unsigned char* in) {
+	return getU16(in) | ((unsigned)getU16(in + 2) << 16);
+}
+
+inline void putHeader(vector<unsigned char>& out, const messageHeader& header) {
+	putU32(out, header.length);
+	out.push_back(header.type);
+	out.push_back(header.status);
+	putU16(out, 0);
+	putU32(out, header.tag);
+}
+
+inline messageHeader getHeader(const unsigned char* in) {
+	messageHeader header;
+	header.length = getU32(in);
+	header.type = in[4];
+	header.status = in[5];
+	header.tag = getU32(in + 8);
+	return header;
+}
@@ -0,0 +1,218 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <iomanip>
+#include "Debug.h"
+#include "RomAnalysis.h"
+
+using namespace std;
+
+//The first address of [first, first + count) inside the watched range, or -1. Addresses wrap with mask.
+static int overlap(const watchpoint& watch, unsigned first, unsigned count, unsigned mask) {
+	for (unsigned i = 0; i < count; i++) {
+		unsigned address = (first + i) & mask;
+		if (address >= watch.first && address <= watch.last) {
+			return (int)address;
+		}
+	}
+	return -1;
+}
+
+
+debugger::debugger(chip8& target) : machine(target) {
+}
+
+
+int debugger::addBreakpoint(unsigned short address, breakCondition condition) {
+	breakpoints.push_back({ address, condition });
+	return (int)breakpoints.size() - 1;
+}
+
+
+int debugger::addWatchpoint(unsigned short first, unsigned short last, int access) {
+	watchpoints.push_back({ first, last, access });
+	return (int)watchpoints.size() - 1;
+}
+
+
+void debugger::removeBreakpoint(int index) {
+	if (index >= 0 && index < (int)breakpoints.size()) {
+		breakpoints.erase(breakpoints.begin() + index);
+	}
+}
+
+
+void debugger::removeWatchpoint(int index) {
+	if (index >= 0 && index < (int)watchpoints.size()) {
+		watchpoints.erase(watchpoints.begin() + index);
+	}
+}
+
+
+const vector<breakpoint>& debugger::getBreakpoints() const {
+	return breakpoints;
+}
+
+
+const vector<watchpoint>& debugger::getWatchpoints() const {
+	return watchpoints;
+}
+
+
+bool debugger::active() const {
+	return !breakpoints.empty() || !watchpoints.empty();
+}
+
+
+bool debugger::conditionHolds(const breakCondition& condition) const {
+	unsigned value = condition.reg == CONDITION_I ? machine.I : machine.V[condition.reg & 15];
+
+	switch (condition.test) {
+	case TEST_EQUAL: return value == condition.value;
+	case TEST_NOT_EQUAL: return value != condition.value;
+	case TEST_LESS: return value < condition.value;
+	case TEST_GREATER: return value > condition.value;
+	case TEST_LESS_EQUAL: return value <= condition.value;
+	case TEST_GREATER_EQUAL: return value >= condition.value;
+	default: return true;
+	}
+}
+
+
+bool debugger::hits(debugStop& stop) const {
+	for (size_t i = 0; i < breakpoints.size(); i++) {
+		if (breakpoints[i].address == machine.pc && conditionHolds(breakpoints[i].condition)) {
+			stop.event = EVENT_BREAKPOINT;
+			stop.index = (int)i;
+			return true;
+		}
+	}
+
+	if (watchpoints.empty()) {
+		return false;
+	}
+
+	memoryAccess access = machine.nextAccess();
+
+	for (size_t i = 0; i < watchpoints.size(); i++) {
+		int address = -1;
+		if (watchpoints[i].access & WATCH_READ) {
+			address = overlap(watchpoints[i], access.readFirst, access.readCount, machine.memoryMask);
+			stop.access = WATCH_READ;
+		}
+		if (address < 0 && (watchpoints[i].access & WATCH_WRITE)) {
+			address = overlap(watchpoints[i], access.writeFirst, access.writeCount, machine.memoryMask);
+			stop.access = WATCH_WRITE;
+		}
+		if (address >= 0) {
+			stop.event = EVENT_WATCHPOINT;
+			stop.index = (int)i;
+			stop.address = (unsigned short)address;
+			return true;
+		}
+	}
+
+	stop.access = 0;
+	return false;
+}
+
+
+debugStop debugger::run(int cycles) {
+	debugStop stop;
+
+	//Nothing to check: the machine's own core, untouched
+	if (!active()) {
+		machine.runCycles(cycles);
+		stop.cycles = cycles;
+		return stop;
+	}
+
+	while (stop.cycles < cycles) {
+		if (machine.pc != stoppedAt && hits(stop)) {
+			stoppedAt = machine.pc;
+			return stop;
+		}
+		machine.emulateCycle();
+		stoppedAt = -1;
+		stop.cycles++;
+	}
+
+	return stop;
+}
+
+
+debugStop debugger::step() {
+	debugStop stop;
+	machine.emulateCycle();
+	stoppedAt = -1;
+	stop.cycles = 1;
+	stop.event = EVENT_STEP;
+	return stop;
+}
+
+
+debugStop debugger::stepOver(int maxCycles) {
+	if ((machine.nextOpcode() & 0xF000) != 0x2000) {
+		return step();
+	}
+
+	//Run until the call has returned to the next opcode at the same stack depth
+	unsigned short returnAddress = (unsigned short)(machine.pc + 2);
+	unsigned short depth = machine.stack_pointer;
+
+	debugStop stop = step();
+	while (stop.cycles < maxCycles && !(machine.pc == returnAddress && machine.stack_pointer == depth)) {
+		debugStop inner;
+		if (hits(inner)) {
+			stoppedAt = machine.pc;
+			inner.cycles = stop.cycles;
+			return inner;
+		}
+		machine.emulateCycle();
+		stop.cycles++;
+	}
+
+	return stop;
+}
+
+
+void debugger::printRegisters(ostream& out) const {
+	unsigned short opcode = machine.nextOpcode();
+
+	out << hex << uppercase << setfill('0');
+	out << "pc " << setw(4) << machine.pc << "  " << setw(4) << opcode << "  " << disassemble(opcode) << endl;
+
+	for (int i = 0; i < 16; i++) {
+		out << "V" << i << " " << setw(2) << (int)machine.V[i] << (i % 8 == 7 ? "\n" : "  ");
+	}
+
+	out << "I  " << setw(4) << machine.I << "  DT " << setw(2) << (int)machine.delay_timer << "  ST " << setw(2)
+		<< (int)machine.sound_timer << endl;
+
+	out << "stack";
+	for (int i = machine.stack_pointer - 1; i >= 0; i--) {
+		out << " " << setw(4) << machine.stack[i];
+	}
+	out << (machine.stack_pointer == 0 ? " empty" : "") << endl;
+
+	out << dec << nouppercase << setfill(' ');
+}
+
+
+void debugger::printMemory(ostream& out, unsigned short first, int count) const {
+	out << hex << uppercase << setfill('0');
+
+	for (int line = 0; line < count; line += 16) {
+		out << setw(4) << ((first + line) & machine.memoryMask) << " ";
+		for (int i = line; i < count && i < line + 16; i++) {
+			out << " " << setw(2) << (int)machine.memory[(first + i) & machine.memoryMask];
+		}
+		out << endl;
+	}
+
+	out << dec << nouppercase << setfill(' ');
+}
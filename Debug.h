@@ -0,0 +1,117 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <ostream>
+#include <vector>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Debugger: breakpoints on pc (optionally only when a condition on a V register or I holds), watchpoints on reads and writes of
+memory ranges, single step, and step over 2NNN calls.
+
+A machine with nothing set is run with runCycles() on whatever core it is on, exactly as without a debugger. Only while at
+least one breakpoint or watchpoint exists does run() switch to stepping one opcode at a time through emulateCycle(), checking
+pc and the memory the opcode is about to touch before executing it. Memory writes still go through storeMemory(), so the
+faster cores find their decodings up to date when the last breakpoint is removed.
+
+Breakpoints and watchpoints stop the machine before the opcode that hit them. The next run() or stepOver() executes that
+opcode before checking again, so calling run() again continues.
+********************************************************************************************************************************/
+
+//Registers a condition can test. 0 - 15 are V0 - VF.
+const int CONDITION_I = 16;
+
+enum conditionTest {
+	TEST_ALWAYS,
+	TEST_EQUAL,
+	TEST_NOT_EQUAL,
+	TEST_LESS,
+	TEST_GREATER,
+	TEST_LESS_EQUAL,
+	TEST_GREATER_EQUAL
+};
+
+struct breakCondition {
+	conditionTest test = TEST_ALWAYS;
+	int reg = 0; //V0 - VF, or CONDITION_I
+	unsigned value = 0;
+};
+
+struct breakpoint {
+	unsigned short address;
+	breakCondition condition;
+};
+
+//Bits of watchpoint::access
+const int WATCH_READ = 1;
+const int WATCH_WRITE = 2;
+
+struct watchpoint {
+	unsigned short first; //First and last address watched, both included
+	unsigned short last;
+	int access;
+};
+
+enum debugEvent {
+	EVENT_NONE, //All the cycles ran
+	EVENT_BREAKPOINT,
+	EVENT_WATCHPOINT,
+	EVENT_STEP //step() or stepOver() finished
+};
+
+//Why run(), step() or stepOver() returned
+struct debugStop {
+	debugEvent event = EVENT_NONE;
+	int cycles = 0; //Opcodes executed
+	int index = -1; //The breakpoint or watchpoint hit
+	int access = 0; //The WATCH_ bit a watchpoint was hit by
+	unsigned short address = 0; //The memory address a watchpoint was hit at
+};
+
+class debugger {
+	chip8& machine;
+	vector<breakpoint> breakpoints;
+	vector<watchpoint> watchpoints;
+	int stoppedAt = -1; //pc of the breakpoint or watchpoint the last call stopped at, so the next one starts by executing it
+
+	bool conditionHolds(const breakCondition& condition) const;
+
+	//Breakpoint or watchpoint the opcode at pc would hit, checked before it runs
+	bool hits(debugStop& stop) const;
+
+public:
+	explicit debugger(chip8& target);
+
+	int addBreakpoint(unsigned short address, breakCondition condition = breakCondition()); //Returns its index
+
+	int addWatchpoint(unsigned short first, unsigned short last, int access); //Returns its index
+
+	void removeBreakpoint(int index);
+
+	void removeWatchpoint(int index);
+
+	const vector<breakpoint>& getBreakpoints() const;
+
+	const vector<watchpoint>& getWatchpoints() const;
+
+	bool active() const; //True while anything is set, so run() steps opcode by opcode
+
+	debugStop run(int cycles); //Run up to cycles opcodes, stopping early at a breakpoint or watchpoint
+
+	debugStop step(); //Run exactly one opcode, ignoring breakpoints and watchpoints
+
+	//Run one opcode, or a whole 2NNN call until it returns (stopping early at a breakpoint or watchpoint, or after maxCycles)
+	debugStop stepOver(int maxCycles);
+
+	void printRegisters(ostream& out) const; //pc and the opcode there, V0 - VF, I, the timers and the stack
+
+	void printMemory(ostream& out, unsigned short first, int count) const; //Hex dump, 16 bytes a line
+};
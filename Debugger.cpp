@@ -0,0 +1,214 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Debugger: runs a ROM without a window under the control of commands typed on standard input (see Debug.h).
+
+Usage: Debugger <rom>
+
+	b ADDRESS [REG OP VALUE]   Breakpoint, optionally only when e.g. "V3 == 5" or "I >= 300" holds (OP: == != < > <= >=)
+	w FIRST[-LAST] [r|w|rw]    Watchpoint on reads and/or writes of a memory range (default rw)
+	l                          List breakpoints and watchpoints
+	db N / dw N                Delete breakpoint / watchpoint N
+	s [N]                      Step N opcodes (default 1)
+	n                          Step over: a 2NNN call runs until it returns
+	c [FRAMES]                 Continue for up to FRAMES frames (default 3600), stopping at breakpoints and watchpoints
+	r                          Registers, the opcode at pc and the stack
+	x ADDRESS [COUNT]          Memory dump
+	k KEY                      Hold or release a key (0 - F)
+	q                          Quit
+
+Addresses and values are hex, counts decimal. Each frame is the ROM library's cycles per frame for the ROM followed by decreaseTimers(), the same as runGame().
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "Chip8.h"
+#include "Debug.h"
+#include "RomLibrary.h"
+
+using namespace std;
+
+chip8 machine;
+int cyclesPerFrame = DEFAULT_CYCLES_PER_FRAME; //The ROM's rate from the ROM library
+int phase = 0; //Opcodes run in the current frame
+
+
+//Count opcodes towards frames, running the timers at the end of each one
+static void advance(int cycles) {
+	phase += cycles;
+	while (phase >= cyclesPerFrame) {
+		phase -= cyclesPerFrame;
+		machine.decreaseTimers();
+	}
+}
+
+
+static unsigned hexValue(const string& text) {
+	return (unsigned)strtoul(text.c_str(), nullptr, 16);
+}
+
+
+static bool parseCondition(istringstream& words, breakCondition& condition) {
+	string reg, test, value;
+	if (!(words >> reg)) {
+		return true;
+	}
+	if (!(words >> test >> value)) {
+		return false;
+	}
+
+	if (reg == "I" || reg == "i") {
+		condition.reg = CONDITION_I;
+	}
+	else if (reg.size() == 2 && (reg[0] == 'V' || reg[0] == 'v')) {
+		condition.reg = (int)hexValue(reg.substr(1));
+	}
+	else {
+		return false;
+	}
+
+	const char* tests[] = { "==", "!=", "<", ">", "<=", ">=" };
+	for (int i = 0; i < 6; i++) {
+		if (test == tests[i]) {
+			condition.test = (conditionTest)(TEST_EQUAL + i);
+		}
+	}
+	condition.value = hexValue(value);
+	return condition.test != TEST_ALWAYS;
+}
+
+
+static void report(const debugger& debug, const debugStop& stop) {
+	if (stop.event == EVENT_BREAKPOINT) {
+		cout << "Breakpoint " << stop.index << endl;
+	}
+	else if (stop.event == EVENT_WATCHPOINT) {
+		cout << "Watchpoint " << stop.index << ": " << (stop.access == WATCH_READ ? "read of " : "write to ") << hex << uppercase
+			<< stop.address << dec << nouppercase << endl;
+	}
+	debug.printRegisters(cout);
+}
+
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		cout << "Usage: Debugger <rom>" << endl;
+		return 1;
+	}
+
+	machine.initialize();
+	machine.setQuirks(quirksForRom(argv[1]));
+	machine.setCore(CORE_THREADED);
+	ifstream file(argv[1], ios::in | ios::binary);
+	vector<unsigned char> rom((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+	machine.loadProgram(rom.data(), rom.size());
+	cyclesPerFrame = romInfoFor(rom.data(), rom.size()).cyclesPerFrame;
+	for (int key = 0; key < 16; key++) {
+		machine.key[key] = 0;
+	}
+
+	debugger debug(machine);
+	debug.printRegisters(cout);
+
+	string line;
+	while (cout << "> " << flush, getline(cin, line)) {
+		istringstream words(line);
+		string command, argument;
+		words >> command;
+
+		if (command == "q") {
+			break;
+		}
+		else if (command == "b" && words >> argument) {
+			breakCondition condition;
+			if (!parseCondition(words, condition)) {
+				cout << "Conditions look like V3 == 5 or I >= 300" << endl;
+				continue;
+			}
+			cout << "Breakpoint " << debug.addBreakpoint((unsigned short)hexValue(argument), condition) << endl;
+		}
+		else if (command == "w" && words >> argument) {
+			string kinds = "rw";
+			words >> kinds;
+			size_t dash = argument.find('-');
+			unsigned first = hexValue(argument);
+			unsigned last = dash == string::npos ? first : hexValue(argument.substr(dash + 1));
+			int access = (kinds.find('r') != string::npos ? WATCH_READ : 0) | (kinds.find('w') != string::npos ? WATCH_WRITE : 0);
+			cout << "Watchpoint " << debug.addWatchpoint((unsigned short)first, (unsigned short)last, access) << endl;
+		}
+		else if (command == "l") {
+			cout << hex << uppercase;
+			for (size_t i = 0; i < debug.getBreakpoints().size(); i++) {
+				const breakpoint& point = debug.getBreakpoints()[i];
+				cout << "breakpoint " << i << " at " << point.address;
+				if (point.condition.test != TEST_ALWAYS) {
+					const char* tests[] = { "", "==", "!=", "<", ">", "<=", ">=" };
+					cout << " if " << (point.condition.reg == CONDITION_I ? string("I") : "V" + string(1, "0123456789ABCDEF"[point.condition.reg]))
+						<< " " << tests[point.condition.test] << " " << point.condition.value;
+				}
+				cout << endl;
+			}
+			for (size_t i = 0; i < debug.getWatchpoints().size(); i++) {
+				const watchpoint& watch = debug.getWatchpoints()[i];
+				cout << "watchpoint " << i << " on " << watch.first << "-" << watch.last << (watch.access & WATCH_READ ? " r" : "")
+					<< (watch.access & WATCH_WRITE ? " w" : "") << endl;
+			}
+			cout << dec << nouppercase;
+		}
+		else if (command == "db" && words >> argument) {
+			debug.removeBreakpoint(atoi(argument.c_str()));
+		}
+		else if (command == "dw" && words >> argument) {
+			debug.removeWatchpoint(atoi(argument.c_str()));
+		}
+		else if (command == "s") {
+			int count = words >> argument ? atoi(argument.c_str()) : 1;
+			for (int i = 0; i < count; i++) {
+				advance(debug.step().cycles);
+			}
+			debug.printRegisters(cout);
+		}
+		else if (command == "n") {
+			debugStop stop = debug.stepOver(cyclesPerFrame * 3600);
+			advance(stop.cycles);
+			report(debug, stop);
+		}
+		else if (command == "c") {
+			long frames = words >> argument ? atol(argument.c_str()) : 3600;
+			debugStop stop;
+			for (long frame = 0; frame < frames && stop.event == EVENT_NONE; frame++) {
+				stop = debug.run(cyclesPerFrame - phase);
+				advance(stop.cycles);
+			}
+			report(debug, stop);
+		}
+		else if (command == "r") {
+			debug.printRegisters(cout);
+		}
+		else if (command == "x" && words >> argument) {
+			string count = "64";
+			words >> count;
+			debug.printMemory(cout, (unsigned short)hexValue(argument), atoi(count.c_str()));
+		}
+		else if (command == "k" && words >> argument) {
+			int key = (int)hexValue(argument) & 15;
+			machine.key[key] = !machine.key[key];
+			cout << "Key " << hex << uppercase << key << dec << nouppercase << (machine.key[key] ? " held" : " released") << endl;
+		}
+		else if (!command.empty()) {
+			cout << "Unknown command (see the top of Debugger.cpp)" << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,48 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Disassembler: lists a ROM's instructions and sprite data, or writes the full analysis as JSON.
+
+Usage: Disassembler <rom> [--json]
+
+The JSON holds every reachable instruction, the basic blocks with their successors, call targets, loop headers, BNNN jump
+sites and sprite data ranges, so other tools can load it instead of discovering the code themselves.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <string>
+#include "RomAnalysis.h"
+
+using namespace std;
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		cout << "Usage: Disassembler <rom> [--json]" << endl;
+		return 1;
+	}
+
+	string romPath = argv[1];
+	bool json = (argc > 2 && string(argv[2]) == "--json");
+
+	vector<unsigned char> rom;
+	if (!readRomFile(romPath, rom)) {
+		cerr << "Could not read a CHIP-8 ROM from " << romPath << endl;
+		return 1;
+	}
+
+	romAnalysis analysis = analyzeRom(rom);
+
+	if (json) {
+		writeJson(cout, analysis, romPath.substr(romPath.find_last_of("/\\") + 1));
+	}
+	else {
+		writeListing(cout, analysis);
+	}
+
+	return 0;
+}
@@ -0,0 +1,84 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+/*******************************************************************************************************************************
+The display is stored as one 128-bit word per row, 1 bit per pixel, so the SUPER-CHIP 128x64 screen is 64 words and the
+64x32 CHIP-8 screen is the left half of the top 32. Pixel 0 (the left edge) is the most significant bit of hi.
+Sprite rows, collisions and scrolls are then a few shifts and logic operations per row instead of a loop over pixels.
+********************************************************************************************************************************/
+
+struct displayRow {
+	unsigned long long hi; //Pixels 0-63
+	unsigned long long lo; //Pixels 64-127
+};
+
+inline displayRow rowAnd(displayRow a, displayRow b) {
+	return { a.hi & b.hi, a.lo & b.lo };
+}
+
+inline displayRow rowOr(displayRow a, displayRow b) {
+	return { a.hi | b.hi, a.lo | b.lo };
+}
+
+inline displayRow rowXor(displayRow a, displayRow b) {
+	return { a.hi ^ b.hi, a.lo ^ b.lo };
+}
+
+inline bool rowIsEmpty(displayRow row) {
+	return (row.hi | row.lo) == 0;
+}
+
+//Moves every pixel n places to the right (0 <= n < 128). Pixels pushed past pixel 127 are lost.
+inline displayRow rowShiftRight(displayRow row, int n) {
+	if (n == 0) return row;
+	if (n >= 64) return { 0, row.hi >> (n - 64) };
+	return { row.hi >> n, (row.lo >> n) | (row.hi << (64 - n)) };
+}
+
+//Moves every pixel n places to the left (0 <= n < 128). Pixels pushed past pixel 0 are lost.
+inline displayRow rowShiftLeft(displayRow row, int n) {
+	if (n == 0) return row;
+	if (n >= 64) return { row.lo << (n - 64), 0 };
+	return { (row.hi << n) | (row.lo >> (64 - n)), row.lo << n };
+}
+
+//Pixels 0 to width - 1 set
+inline displayRow rowMask(int width) {
+	if (width >= 128) return { ~0ull, ~0ull };
+	if (width >= 64) return { ~0ull, width == 64 ? 0 : ~0ull << (128 - width) };
+	return { width == 0 ? 0 : ~0ull << (64 - width), 0 };
+}
+
+//A sprite row of width bits (8 or 16) at pixels 0 to width - 1, most significant bit first
+inline displayRow spriteRow(unsigned bits, int width) {
+	return { (unsigned long long)bits << (64 - width), 0 };
+}
+
+inline bool rowPixel(displayRow row, int x) {
+	return x < 64 ? ((row.hi >> (63 - x)) & 1) : ((row.lo >> (127 - x)) & 1);
+}
+
+//Pixels 8i to 8i + 7 (0 <= i < 16), pixel 8i in the most significant bit
+inline unsigned char rowByte(displayRow row, int i) {
+	return (unsigned char)(i < 8 ? row.hi >> (56 - i * 8) : row.lo >> (120 - i * 8));
+}
+
+//A row with only pixels 8i to 8i + 7 taken from value
+inline displayRow byteRow(unsigned char value, int i) {
+	if (i < 8) return { (unsigned long long)value << (56 - i * 8), 0 };
+	return { 0, (unsigned long long)value << (120 - i * 8) };
+}
+
+//RGB colour of each combination of lit planes (bit p = plane p). Plane 0 alone is the classic green.
+const float displayPalette[16][3] = {
+	{ 0, 0, 0 }, { 0, 1, 0 }, { 1, 0, 0 }, { 1, 1, 0 },
+	{ 0, 0, 1 }, { 0, 1, 1 }, { 1, 0, 1 }, { 1, 1, 1 },
+	{ 0.5f, 0.5f, 0.5f }, { 0, 0.5f, 0 }, { 0.5f, 0, 0 }, { 0.5f, 0.5f, 0 },
+	{ 0, 0, 0.5f }, { 0, 0.5f, 0.5f }, { 0.5f, 0, 0.5f }, { 0.75f, 0.75f, 0.75f }
+};
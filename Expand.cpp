@@ -0,0 +1,269 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <cstring>
+#include "Expand.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define EXPAND_X86
+#define SSE2_TARGET __attribute__((target("sse2")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define EXPAND_X86
+#define SSE2_TARGET
+#define AVX2_TARGET
+#endif
+
+using namespace std;
+
+
+framebufferView viewOf(const chip8& machine) {
+	framebufferView view;
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		view.planes[plane] = machine.displayRows(plane);
+	}
+	view.width = machine.displayWidth();
+	view.height = machine.displayHeight();
+
+	return view;
+}
+
+
+void setPaletteColor(expandPalette& palette, int color, unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+	unsigned char bytes[4] = { r, g, b, a };
+	memcpy(&palette.rgba[color], bytes, 4);
+	palette.gray[color] = (unsigned char)((r * 77 + g * 150 + b * 29) >> 8);
+}
+
+
+expandPalette defaultPalette() {
+	expandPalette palette;
+
+	for (int color = 0; color < 16; color++) {
+		setPaletteColor(palette, color, (unsigned char)(displayPalette[color][0] * 255),
+			(unsigned char)(displayPalette[color][1] * 255), (unsigned char)(displayPalette[color][2] * 255));
+	}
+
+	return palette;
+}
+
+
+static bool detectAvx2() {
+#if defined(EXPAND_X86) && defined(__GNUC__)
+	return __builtin_cpu_supports("avx2");
+#elif defined(EXPAND_X86)
+	//AVX2 needs the CPU flag and an OS that saves the YMM registers
+	int info[4];
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6) {
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+
+static bool detectSse2() {
+#if defined(EXPAND_X86) && defined(__GNUC__)
+	return __builtin_cpu_supports("sse2");
+#elif defined(EXPAND_X86)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0;
+#else
+	return false;
+#endif
+}
+
+
+bool expandPathSupported(expandPath path) {
+	static const bool sse2 = detectSse2();
+	static const bool avx2 = detectAvx2();
+
+	switch (path) {
+	case EXPAND_SCALAR: return true;
+	case EXPAND_SSE2: return sse2;
+	case EXPAND_AVX2: return avx2;
+	default: return false;
+	}
+}
+
+
+expandPath fastestExpandPath() {
+	static const expandPath fastest = expandPathSupported(EXPAND_AVX2) ? EXPAND_AVX2 :
+		expandPathSupported(EXPAND_SSE2) ? EXPAND_SSE2 : EXPAND_SCALAR;
+	return fastest;
+}
+
+
+const char* expandPathName(expandPath path) {
+	switch (path) {
+	case EXPAND_SCALAR: return "scalar";
+	case EXPAND_SSE2: return "sse2";
+	case EXPAND_AVX2: return "avx2";
+	default: return "";
+	}
+}
+
+
+//Palette index of every pixel of one line
+static void lineColors(const framebufferView& view, int y, unsigned char* colors) {
+	memset(colors, 0, view.width);
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		if (view.planes[plane] == nullptr || rowIsEmpty(view.planes[plane][y])) {
+			continue;
+		}
+
+		for (int i = 0; i < view.width / 8; i++) {
+			unsigned char bits = rowByte(view.planes[plane][y], i);
+			for (int k = 0; k < 8; k++) {
+				colors[i * 8 + k] |= ((bits >> (7 - k)) & 1) << plane;
+			}
+		}
+	}
+}
+
+
+/*******************************************************************************************************************************
+Row kernels. Each pixel becomes scale copies of its colour. The vector versions store a whole register per step, starting at
+the pixel's first output element; a store that runs past the pixel spills in to the next pixel's output, which the next pixel
+then overwrites. So every scale is handled without masks, and only the last few pixels, whose spill would run off the end
+of the row, are finished one element at a time.
+
+Rows start wherever the caller's stride puts them, so out is a byte pointer and elements are stored unaligned: memcpy() in
+the scalar kernel, storeu in the vector ones.
+********************************************************************************************************************************/
+
+template <typename T>
+static void expandRowScalar(const unsigned char* colors, int width, int scale, const T* palette, unsigned char* out, int first) {
+	for (int x = first; x < width; x++) {
+		T value = palette[colors[x]];
+		for (int s = 0; s < scale; s++) {
+			memcpy(out + (size_t)(x * scale + s) * sizeof(T), &value, sizeof(T));
+		}
+	}
+}
+
+
+#ifdef EXPAND_X86
+
+SSE2_TARGET static void expandRowRgbaSse2(const unsigned char* colors, int width, int scale, const unsigned* palette, unsigned char* out) {
+	const int rowEnd = width * scale;
+	int x = 0;
+
+	for (; x < width && x * scale + scale + 3 <= rowEnd; x++) {
+		__m128i value = _mm_set1_epi32((int)palette[colors[x]]);
+		for (int s = 0; s < scale; s += 4) {
+			_mm_storeu_si128((__m128i*)(out + (x * scale + s) * 4), value);
+		}
+	}
+
+	expandRowScalar(colors, width, scale, palette, out, x);
+}
+
+
+SSE2_TARGET static void expandRowGraySse2(const unsigned char* colors, int width, int scale, const unsigned char* palette, unsigned char* out) {
+	const int rowEnd = width * scale;
+	int x = 0;
+
+	for (; x < width && x * scale + scale + 15 <= rowEnd; x++) {
+		__m128i value = _mm_set1_epi8((char)palette[colors[x]]);
+		for (int s = 0; s < scale; s += 16) {
+			_mm_storeu_si128((__m128i*)(out + x * scale + s), value);
+		}
+	}
+
+	expandRowScalar(colors, width, scale, palette, out, x);
+}
+
+
+AVX2_TARGET static void expandRowRgbaAvx2(const unsigned char* colors, int width, int scale, const unsigned* palette, unsigned char* out) {
+	const int rowEnd = width * scale;
+	int x = 0;
+
+	for (; x < width && x * scale + scale + 7 <= rowEnd; x++) {
+		__m256i value = _mm256_set1_epi32((int)palette[colors[x]]);
+		for (int s = 0; s < scale; s += 8) {
+			_mm256_storeu_si256((__m256i*)(out + (x * scale + s) * 4), value);
+		}
+	}
+
+	expandRowScalar(colors, width, scale, palette, out, x);
+}
+
+
+AVX2_TARGET static void expandRowGrayAvx2(const unsigned char* colors, int width, int scale, const unsigned char* palette, unsigned char* out) {
+	const int rowEnd = width * scale;
+	int x = 0;
+
+	for (; x < width && x * scale + scale + 31 <= rowEnd; x++) {
+		__m256i value = _mm256_set1_epi8((char)palette[colors[x]]);
+		for (int s = 0; s < scale; s += 32) {
+			_mm256_storeu_si256((__m256i*)(out + x * scale + s), value);
+		}
+	}
+
+	expandRowScalar(colors, width, scale, palette, out, x);
+}
+
+#endif
+
+
+void expandRgba(const framebufferView& view, int scale, const expandPalette& palette, unsigned char* out, size_t stride, expandPath path) {
+	unsigned char colors[128];
+	const size_t rowBytes = (size_t)view.width * scale * 4;
+
+	for (int y = 0; y < view.height; y++) {
+		lineColors(view, y, colors);
+
+		unsigned char* first = out + (size_t)y * scale * stride;
+
+		switch (path) {
+#ifdef EXPAND_X86
+		case EXPAND_AVX2: expandRowRgbaAvx2(colors, view.width, scale, palette.rgba, first); break;
+		case EXPAND_SSE2: expandRowRgbaSse2(colors, view.width, scale, palette.rgba, first); break;
+#endif
+		default: expandRowScalar(colors, view.width, scale, palette.rgba, first, 0); break;
+		}
+
+		for (int s = 1; s < scale; s++) {
+			memcpy(first + s * stride, first, rowBytes);
+		}
+	}
+}
+
+
+void expandGray(const framebufferView& view, int scale, const expandPalette& palette, unsigned char* out, size_t stride, expandPath path) {
+	unsigned char colors[128];
+	const size_t rowBytes = (size_t)view.width * scale;
+
+	for (int y = 0; y < view.height; y++) {
+		lineColors(view, y, colors);
+
+		unsigned char* first = out + (size_t)y * scale * stride;
+
+		switch (path) {
+#ifdef EXPAND_X86
+		case EXPAND_AVX2: expandRowGrayAvx2(colors, view.width, scale, palette.gray, first); break;
+		case EXPAND_SSE2: expandRowGraySse2(colors, view.width, scale, palette.gray, first); break;
+#endif
+		default: expandRowScalar(colors, view.width, scale, palette.gray, first, 0); break;
+		}
+
+		for (int s = 1; s < scale; s++) {
+			memcpy(first + s * stride, first, rowBytes);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <cstddef>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Framebuffer expansion: turns the packed display (Display.h) in to host pixels, RGBA8 or 8-bit grayscale, with every CHIP-8
+pixel blown up to scale x scale. Used for screenshots, video export and software display instead of drawPixels().
+
+Each source row is expanded once with vector stores (SSE2 or AVX2, picked at run time from what the CPU supports) and then
+copied to the other scale - 1 output rows. Nothing is allocated; the caller owns the output buffer.
+********************************************************************************************************************************/
+
+//Code paths of the expansion kernels
+enum expandPath {
+	EXPAND_SCALAR, //Plain C++, available everywhere
+	EXPAND_SSE2, //16-byte stores (x86)
+	EXPAND_AVX2, //32-byte stores (x86 with AVX2)
+	EXPAND_PATH_COUNT
+};
+
+//The display to expand. planes[p] is plane p, one row per line; nullptr for a plane that is known to be blank.
+struct framebufferView {
+	const displayRow* planes[DISPLAY_PLANES];
+	int width; //64 or 128
+	int height; //32 or 64
+};
+
+//Output colour for every combination of lit planes (bit p = plane p)
+struct expandPalette {
+	unsigned rgba[16]; //R, G, B, A bytes in memory order
+	unsigned char gray[16];
+};
+
+framebufferView viewOf(const chip8& machine); //The machine's current display
+
+expandPalette defaultPalette(); //displayPalette, opaque, with gray as the luminance of each colour
+
+void setPaletteColor(expandPalette& palette, int color, unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255);
+
+bool expandPathSupported(expandPath path); //True if this build and CPU can run path
+
+expandPath fastestExpandPath(); //The widest supported path, detected once
+
+const char* expandPathName(expandPath path);
+
+//Write (view.height * scale) rows of (view.width * scale) RGBA pixels, stride bytes apart (stride >= view.width * scale * 4).
+//Neither out nor stride needs to be aligned.
+void expandRgba(const framebufferView& view, int scale, const expandPalette& palette, unsigned char* out, size_t stride,
+	expandPath path = fastestExpandPath());
+
+//Write (view.height * scale) rows of (view.width * scale) gray bytes, stride bytes apart (stride >= view.width * scale)
+void expandGray(const framebufferView& view, int scale, const expandPalette& palette, unsigned char* out, size_t stride,
+	expandPath path = fastestExpandPath());
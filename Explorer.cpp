@@ -0,0 +1,459 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+State-space explorer: finds every state a ROM can reach under any keypad input, breadth first, on every core.
+
+Usage: Explorer <rom> [--depth N] [--threads N] [--memory MB] [--states N] [--stall-frames N]
+                      [--target HASH] [--target-memory ADDRESS=VALUE]
+
+The machine runs on its own until it is about to execute an instruction that reads the keypad (EX9E, EXA1 or FX0A), which is
+a decision point. From there the explorer tries every input that makes a difference: Vx held or nothing held for EX9E and
+EXA1, each of the 16 keys for FX0A. No key is held between decision points. A branch ends when the program halts (00FD or a
+jump to itself) or runs --stall-frames frames (default 600) without reading the keypad. That limit only applies between
+decision points: a ROM may run for much longer on its own first (PUZZLE shuffles its tiles), so the first one is looked for
+over FIRST_DECISION_FRAMES frames.
+
+States are the machine state at a decision point plus how far in to the frame it is (frames run the ROM library's cycles per
+frame for the ROM), deduplicated by their 64-bit state hash (chip8::stateHash()) in a lock-free set of --states entries
+(default 16M). CXKK uses a fixed seed, and states that only differ in the random engine count as one.
+
+Each depth is expanded in parallel. Machines waiting in the next depth are forks (CowPages.h), so they cost only the pages
+they changed. Past --memory MB (default 1024) of waiting machines, the rest are spilled to a temporary file as their place
+in the search tree and rebuilt by replaying their inputs from the start when their turn comes.
+
+The search stops at the first state that matches a target (a state hash, or a byte of memory) and prints the inputs that
+reach it: the frame of each decision point and the key held there.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include "Chip8.h"
+#include "ConcurrentSet.h"
+#include "RomLibrary.h"
+#include "WorkerPool.h"
+
+using namespace std;
+
+const unsigned char NO_KEY = 16; //Input choice: nothing held
+const size_t BATCH_SIZE = 4096; //States expanded per forEach() call
+const unsigned FIRST_DECISION_FRAMES = 1000000; //How long the ROM may run before its first keypad read, about 5 hours of play
+
+//A machine and how many cycles of its current frame it has run
+struct cursor {
+	chip8 machine;
+	int phase = 0; //-1: not built yet, see replay()
+};
+
+//One state in the search tree. The root is nodes[0].
+struct node {
+	unsigned long long parent;
+	unsigned frames; //Frames from the parent's decision point to this state
+	unsigned char choice; //Input chosen at the parent's decision point
+};
+
+enum stopReason {
+	STOP_DECISION, //About to read the keypad
+	STOP_HALTED,
+	STOP_STALLED
+};
+
+//A new state found by expanding a node
+struct successor {
+	node link;
+	stopReason stop;
+	bool target;
+	cursor position;
+};
+
+//Where a state in the current depth is: in memory, or only in the search tree (spilled)
+struct pending {
+	unsigned long long id;
+	cursor position;
+};
+
+struct explorerOptions {
+	string rom;
+	int depth = 1000000;
+	unsigned threads = 0;
+	size_t memoryBytes = 1024ull << 20;
+	size_t states = 16u << 20;
+	unsigned stallFrames = 600;
+	bool hasTargetHash = false;
+	unsigned long long targetHash = 0;
+	int targetAddress = -1;
+	unsigned char targetValue = 0;
+};
+
+explorerOptions options;
+int cyclesPerFrame = DEFAULT_CYCLES_PER_FRAME; //The ROM's rate from the ROM library, like runGame()
+vector<node> nodes;
+cursor root;
+unique_ptr<concurrentHashSet> visited;
+atomic<unsigned long long> duplicates{ 0 };
+
+
+//The instructions that read the keypad, decoded the way executeCycle() does
+static bool readsKeys(const chip8& machine, unsigned short opcode) {
+	if ((opcode & 0xF00F) == 0xE00E || (opcode & 0xF00F) == 0xE001) {
+		return true;
+	}
+	return (opcode & 0xF00F) == 0xF00A && !(machine.isXoChip() && (opcode & 0x00F0) == 0x0030);
+}
+
+
+static void step(cursor& c, unsigned& frames) {
+	c.machine.emulateCycle();
+	if (++c.phase == cyclesPerFrame) {
+		c.phase = 0;
+		c.machine.decreaseTimers();
+		frames++;
+	}
+}
+
+
+//Run until the next decision point, or until the program halts or stalls for stallFrames frames
+static stopReason runToDecision(cursor& c, unsigned& frames, unsigned stallFrames = options.stallFrames) {
+	unsigned start = frames;
+
+	while (true) {
+		unsigned short opcode = c.machine.nextOpcode();
+
+		if (c.phase == 0) {
+			unsigned short pc = c.machine.getRegisters().pc;
+			if (opcode == 0x00FD || opcode == (0x1000 | pc)) {
+				return STOP_HALTED;
+			}
+			if (frames - start >= stallFrames) {
+				return STOP_STALLED;
+			}
+		}
+
+		if (readsKeys(c.machine, opcode)) {
+			return STOP_DECISION;
+		}
+
+		step(c, frames);
+	}
+}
+
+
+//The inputs that make a difference at a decision point
+static vector<unsigned char> choices(const cursor& c) {
+	unsigned short opcode = c.machine.nextOpcode();
+	vector<unsigned char> inputs;
+
+	if ((opcode & 0xF000) == 0xE000) {
+		unsigned char key = c.machine.getRegisters().V[(opcode & 0x0F00) >> 8];
+		if (key < 16) {
+			inputs.push_back(key);
+		}
+		inputs.push_back(NO_KEY);
+	}
+	else {
+		for (unsigned char key = 0; key < 16; key++) {
+			inputs.push_back(key);
+		}
+	}
+
+	return inputs;
+}
+
+
+//Execute the instruction at a decision point with choice held
+static void apply(cursor& c, unsigned char choice, unsigned& frames) {
+	if (choice != NO_KEY) {
+		c.machine.key[choice] = 1;
+	}
+	step(c, frames);
+	if (choice != NO_KEY) {
+		c.machine.key[choice] = 0;
+	}
+}
+
+
+//The same machine state in a different part of the frame is a different state
+static unsigned long long stateKey(const cursor& c) {
+	return c.machine.stateHash() ^ hashMix((unsigned long long)c.phase + 1);
+}
+
+
+static bool isTarget(const cursor& c) {
+	if (options.hasTargetHash && c.machine.stateHash() == options.targetHash) {
+		return true;
+	}
+	return options.targetAddress >= 0 && c.machine.readMemory((unsigned short)options.targetAddress) == options.targetValue;
+}
+
+
+//Inputs from the root to a node, first one first
+static vector<unsigned long long> pathTo(unsigned long long id) {
+	vector<unsigned long long> path;
+	for (; id != 0; id = nodes[id].parent) {
+		path.push_back(id);
+	}
+	reverse(path.begin(), path.end());
+	return path;
+}
+
+
+//Rebuild a spilled state by replaying the inputs that led to it
+static cursor replay(unsigned long long id) {
+	cursor c = root;
+	unsigned frames = 0;
+
+	for (unsigned long long along : pathTo(id)) {
+		apply(c, nodes[along].choice, frames);
+		runToDecision(c, frames);
+	}
+
+	return c;
+}
+
+
+static void expand(const pending& state, vector<successor>& found) {
+	cursor c = state.position.phase < 0 ? replay(state.id) : state.position;
+
+	for (unsigned char choice : choices(c)) {
+		cursor next = c;
+		unsigned frames = 0;
+		apply(next, choice, frames);
+		stopReason stop = runToDecision(next, frames);
+
+		if (!visited->insert(stateKey(next))) {
+			duplicates.fetch_add(1, memory_order_relaxed);
+			continue;
+		}
+
+		found.push_back({ { state.id, frames, choice }, stop, isTarget(next), next });
+	}
+}
+
+
+static void printInputs(unsigned long long id) {
+	unsigned long long frame = nodes[0].frames;
+
+	cout << "Inputs (frames counted from the start of the ROM):" << endl;
+	for (unsigned long long along : pathTo(id)) {
+		cout << "  frame " << setw(8) << frame << "  ";
+		if (nodes[along].choice == NO_KEY) {
+			cout << "no key" << endl;
+		}
+		else {
+			cout << "key " << hex << uppercase << (int)nodes[along].choice << dec << nouppercase << endl;
+		}
+		frame += nodes[along].frames;
+	}
+}
+
+
+static bool parseArguments(int argc, char** argv) {
+	if (argc < 2) {
+		return false;
+	}
+	options.rom = argv[1];
+
+	for (int i = 2; i + 1 < argc; i += 2) {
+		string name = argv[i];
+		string value = argv[i + 1];
+
+		if (name == "--depth") {
+			options.depth = atoi(value.c_str());
+		}
+		else if (name == "--threads") {
+			options.threads = (unsigned)atoi(value.c_str());
+		}
+		else if (name == "--memory") {
+			options.memoryBytes = (size_t)atoll(value.c_str()) << 20;
+		}
+		else if (name == "--states") {
+			options.states = (size_t)atoll(value.c_str());
+		}
+		else if (name == "--stall-frames") {
+			options.stallFrames = (unsigned)atoi(value.c_str());
+		}
+		else if (name == "--target") {
+			options.hasTargetHash = true;
+			options.targetHash = strtoull(value.c_str(), nullptr, 16);
+		}
+		else if (name == "--target-memory" && value.find('=') != string::npos) {
+			options.targetAddress = (int)strtoul(value.c_str(), nullptr, 0) & 0xFFFF;
+			options.targetValue = (unsigned char)strtoul(value.c_str() + value.find('=') + 1, nullptr, 0);
+		}
+		else {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+int main(int argc, char** argv) {
+	if (!parseArguments(argc, argv)) {
+		cout << "Usage: Explorer <rom> [--depth N] [--threads N] [--memory MB] [--states N] [--stall-frames N]" << endl;
+		cout << "                      [--target HASH] [--target-memory ADDRESS=VALUE]" << endl;
+		return 1;
+	}
+
+	workerPool pool(options.threads > 0 ? options.threads : thread::hardware_concurrency());
+	visited.reset(new concurrentHashSet(options.states));
+
+	root.machine.initialize();
+	root.machine.setQuirks(quirksForRom(options.rom));
+	ifstream file(options.rom, ios::in | ios::binary);
+	vector<unsigned char> rom((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+	root.machine.loadProgram(rom.data(), rom.size());
+	cyclesPerFrame = romInfoFor(rom.data(), rom.size()).cyclesPerFrame;
+	root.machine.seedRandom(1);
+	for (int key = 0; key < 16; key++) {
+		root.machine.key[key] = 0;
+	}
+
+	unsigned firstFrames = 0;
+	if (runToDecision(root, firstFrames, FIRST_DECISION_FRAMES) != STOP_DECISION) {
+		cout << options.rom << " never reads the keypad in its first " << FIRST_DECISION_FRAMES << " frames" << endl;
+		return 1;
+	}
+
+	nodes.push_back({ 0, firstFrames, NO_KEY });
+	visited->insert(stateKey(root));
+
+	cout << options.rom << ": first decision point after " << firstFrames << " frames, state " << hex << setw(16) << setfill('0')
+		<< root.machine.stateHash() << dec << setfill(' ') << ", " << pool.size() << " threads" << endl;
+
+	auto start = chrono::steady_clock::now();
+	vector<pending> current;
+	current.push_back({ 0, root });
+	FILE* currentSpill = nullptr;
+	size_t currentSpilled = 0;
+	unsigned long long ended = 0;
+	long long targetId = -1;
+	int depth = 0;
+
+	while ((!current.empty() || currentSpilled > 0) && depth < options.depth && targetId < 0 && !visited->full()) {
+		vector<pending> next;
+		FILE* nextSpill = nullptr;
+		size_t nextSpilled = 0;
+		size_t nextBytes = 0;
+		size_t levelStates = 0;
+		size_t levelEnded = 0;
+
+		if (currentSpill != nullptr) {
+			rewind(currentSpill);
+		}
+
+		while ((!current.empty() || currentSpilled > 0) && targetId < 0 && !visited->full()) {
+			//Take a batch from the end of the in-memory states, then from the spill file
+			vector<pending> batch;
+			if (!current.empty()) {
+				size_t take = min(BATCH_SIZE, current.size());
+				batch.assign(make_move_iterator(current.end() - take), make_move_iterator(current.end()));
+				current.erase(current.end() - take, current.end());
+			}
+			else {
+				vector<unsigned long long> ids(min(BATCH_SIZE, currentSpilled));
+				ids.resize(fread(ids.data(), sizeof(unsigned long long), ids.size(), currentSpill));
+				currentSpilled = ids.size() < min(BATCH_SIZE, currentSpilled) ? 0 : currentSpilled - ids.size();
+				for (unsigned long long id : ids) {
+					batch.push_back({ id, cursor{ root.machine, -1 } });
+				}
+			}
+
+			vector<vector<successor>> found(batch.size());
+			pool.forEach(batch.size(), [&](size_t i) {
+				expand(batch[i], found[i]);
+			});
+			batch.clear();
+
+			for (vector<successor>& list : found) {
+				for (successor& s : list) {
+					unsigned long long id = nodes.size();
+					nodes.push_back(s.link);
+					levelStates++;
+
+					if (s.target && targetId < 0) {
+						targetId = (long long)id;
+					}
+
+					if (s.stop != STOP_DECISION) {
+						levelEnded++;
+					}
+					else if (nextBytes < options.memoryBytes) {
+						nextBytes += sizeof(pending) + s.position.machine.unsharedBytes();
+						next.push_back({ id, move(s.position) });
+					}
+					else {
+						if (nextSpill == nullptr) {
+							nextSpill = tmpfile();
+						}
+						if (nextSpill == nullptr || fwrite(&id, sizeof(id), 1, nextSpill) != 1) {
+							cout << "Could not spill states to a temporary file" << endl;
+							return 1;
+						}
+						nextSpilled++;
+					}
+				}
+				list.clear();
+			}
+		}
+
+		if (currentSpill != nullptr) {
+			fclose(currentSpill);
+		}
+		current = move(next);
+		currentSpill = nextSpill;
+		currentSpilled = nextSpilled;
+		ended += levelEnded;
+		depth++;
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		cout << "depth " << setw(4) << depth << ": " << setw(10) << levelStates << " new states (" << levelEnded << " ended, "
+			<< nextSpilled << " spilled), " << setw(10) << nodes.size() << " total, " << fixed << setprecision(0)
+			<< nodes.size() / max(seconds, 1e-9) << " states/s" << defaultfloat << endl;
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	cout << nodes.size() << " distinct states to depth " << depth << " (" << ended << " ended, " << duplicates << " duplicates) in "
+		<< fixed << setprecision(2) << seconds << " s, " << setprecision(0) << nodes.size() / max(seconds, 1e-9) << " states/s"
+		<< defaultfloat << endl;
+
+	if (visited->full()) {
+		cout << "Stopped: the visited set is full (--states " << visited->capacity() << ")" << endl;
+	}
+	else if (!current.empty() || currentSpilled > 0) {
+		cout << "Stopped at --depth " << options.depth << " with " << current.size() + currentSpilled << " states left" << endl;
+	}
+	else if (targetId < 0) {
+		cout << "Every reachable state was visited" << endl;
+	}
+
+	if (options.hasTargetHash || options.targetAddress >= 0) {
+		if (targetId < 0) {
+			cout << "No target state was reached" << endl;
+			return 2;
+		}
+		cout << "Target reached at depth " << pathTo(targetId).size() << endl;
+		printInputs(targetId);
+	}
+
+	if (currentSpill != nullptr) {
+		fclose(currentSpill);
+	}
+	return 0;
+}
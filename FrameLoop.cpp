@@ -0,0 +1,127 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <GL/freeglut.h>
+#include "FrameLoop.h"
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#include <GL/glx.h> //Last, as Xlib defines macros like None and Status
+#endif
+
+using namespace std;
+
+#ifdef __linux__
+static chrono::nanoseconds monotonicNow() {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return chrono::seconds(now.tv_sec) + chrono::nanoseconds(now.tv_nsec);
+}
+
+
+static timespec toTimespec(chrono::nanoseconds time) {
+	timespec converted;
+	converted.tv_sec = (time_t)(time.count() / 1000000000);
+	converted.tv_nsec = (long)(time.count() % 1000000000);
+	return converted;
+}
+#endif
+
+
+frameLoop::frameLoop(chrono::nanoseconds framePeriod) : period(framePeriod) {
+#ifdef __linux__
+	poller = epoll_create1(EPOLL_CLOEXEC);
+	timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (!isOpen()) {
+		return;
+	}
+
+	epoll_event event = {};
+	event.events = EPOLLIN;
+	event.data.fd = timer;
+	epoll_ctl(poller, EPOLL_CTL_ADD, timer, &event);
+
+	//Without an X connection (another GLUT backend) events are still handled, once a frame
+	Display* connection = glXGetCurrentDisplay();
+	if (connection != nullptr) {
+		display = ConnectionNumber(connection);
+		event.data.fd = display;
+		epoll_ctl(poller, EPOLL_CTL_ADD, display, &event);
+	}
+
+	arm(monotonicNow() + period);
+#endif
+}
+
+
+frameLoop::~frameLoop() {
+#ifdef __linux__
+	if (timer >= 0) {
+		close(timer);
+	}
+	if (poller >= 0) {
+		close(poller);
+	}
+#endif
+}
+
+
+bool frameLoop::isOpen() const {
+	return poller >= 0 && timer >= 0;
+}
+
+
+void frameLoop::arm(chrono::nanoseconds first) {
+#ifdef __linux__
+	itimerspec ticks;
+	ticks.it_value = toTimespec(first);
+	ticks.it_interval = toTimespec(period);
+	timerfd_settime(timer, TFD_TIMER_ABSTIME, &ticks, nullptr);
+
+	deadline = first - period; //The first expiry moves it on to first
+	running = true;
+#endif
+}
+
+
+void frameLoop::run(const function<bool(long long late)>& frame) {
+#ifdef __linux__
+	while (isOpen()) {
+		glutMainLoopEvent(); //Input, reshapes and the redisplay the last frame posted
+
+		epoll_event ready[2];
+		int count = epoll_wait(poller, ready, 2, running ? -1 : 100);
+
+		for (int i = 0; i < count; i++) {
+			unsigned long long expired;
+			if (ready[i].data.fd != timer || read(timer, &expired, sizeof(expired)) != sizeof(expired)) {
+				continue;
+			}
+
+			//Deadlines missed while a frame overran are not made up; the next frame just starts late
+			deadline += period * (long long)expired;
+			if (!frame((monotonicNow() - deadline).count())) {
+				itimerspec stop = {};
+				timerfd_settime(timer, 0, &stop, nullptr);
+				running = false;
+			}
+		}
+	}
+#endif
+}
+
+
+void frameLoop::wake() {
+#ifdef __linux__
+	if (isOpen() && !running) {
+		arm(monotonicNow());
+	}
+#endif
+}
@@ -0,0 +1,54 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Frame loop for Linux, in place of glutIdleFunc() and glutMainLoop(). Calling runGame() from the idle callback keeps GLUT
+spinning, and the sleep_for() that paces the frames holds up window events and key presses while it sleeps.
+
+Here a timerfd fires at every frame deadline, and epoll waits on it together with the X server connection. The thread
+sleeps until a frame is due or an event comes in, and events are handled as they arrive, in between frames. When frame()
+returns false the timer is stopped and only window events wake the loop, until wake() starts the frames again. Xlib can
+read events off the connection while it draws, and those would not wake epoll, so while the timer is stopped the loop also
+looks for events every 100 ms.
+
+Elsewhere isOpen() is false, and the caller falls back to the GLUT loop.
+********************************************************************************************************************************/
+
+class frameLoop {
+	int poller = -1; //epoll descriptor
+	int timer = -1; //timerfd
+	int display = -1; //X server connection, -1 if there is none to wait on
+	chrono::nanoseconds period;
+	chrono::nanoseconds deadline{ 0 }; //CLOCK_MONOTONIC time of the last frame deadline
+	bool running = false; //True while the timer is armed
+
+	void arm(chrono::nanoseconds first); //Tick every period from first on
+
+public:
+	//Call after glutCreateWindow(), so the window's X connection is known
+	explicit frameLoop(chrono::nanoseconds framePeriod);
+
+	~frameLoop();
+
+	frameLoop(const frameLoop&) = delete;
+	frameLoop& operator=(const frameLoop&) = delete;
+
+	bool isOpen() const; //False if there is no timerfd and epoll, or on other platforms
+
+	//Handle GLUT events and call frame() at every deadline, with how late (ns) the loop woke up for it. Like glutMainLoop()
+	//it only ends when the window is closed and GLUT exits. If frame() returns false, frames stop until wake().
+	void run(const function<bool(long long late)>& frame);
+
+	void wake(); //Start frames again, with the first one straight away
+};
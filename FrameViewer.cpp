@@ -0,0 +1,104 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Shows the display of an emulator running elsewhere, read from the shared-memory segment it publishes (SharedFrame.h).
+
+Usage: FrameViewer <segment name>
+
+Start the emulator with --publish <segment name> first. The viewer maps the segment read-only and polls it 60 times a second,
+so any number of viewers can watch one instance, and an instance never waits for them. The title bar shows the frame number
+and the program counter. When the emulator exits, the last frame stays up.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <GL/freeglut.h>
+#include "SharedFrame.h"
+#include "Expand.h"
+
+using namespace std;
+
+const int WINDOW_WIDTH = 640;
+const int WINDOW_HEIGHT = 320;
+
+frameSubscriber* subscriber;
+publishedFrame frame;
+unsigned long long shownFrame = 0;
+vector<unsigned char> pixels(WINDOW_WIDTH * WINDOW_HEIGHT * 4);
+expandPalette palette = defaultPalette();
+
+void poll();
+void render();
+
+
+int main(int argc, char** argv) {
+	glutInit(&argc, argv);
+
+	if (argc < 2) {
+		cout << "Usage: FrameViewer <segment name>" << endl;
+		return 1;
+	}
+
+	subscriber = new frameSubscriber(argv[1]);
+	if (!subscriber->isOpen()) {
+		cout << "No emulator is publishing " << argv[1] << endl;
+		return 1;
+	}
+
+	glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
+	glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
+	glutCreateWindow(argv[1]);
+
+	glutIdleFunc(poll);
+	glutDisplayFunc(render);
+	glutMainLoop();
+
+	return 0;
+}
+
+
+void poll() {
+	this_thread::sleep_for(chrono::milliseconds(16));
+
+	//Checking the frame number costs nothing, so the frame is only copied and expanded when it changed
+	if (subscriber->latestFrame() == shownFrame || !subscriber->read(frame)) {
+		return;
+	}
+	shownFrame = frame.frame;
+
+	framebufferView view;
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		view.planes[plane] = frame.rows[plane];
+	}
+	view.width = frame.width();
+	view.height = frame.height();
+	expandRgba(view, WINDOW_WIDTH / view.width, palette, pixels.data(), WINDOW_WIDTH * 4);
+
+	if (shownFrame % 15 == 1) {
+		ostringstream title;
+		title << "Frame " << shownFrame << "  PC " << hex << uppercase << setw(4) << setfill('0') << frame.registers.pc
+			<< "  I " << setw(4) << frame.registers.I;
+		glutSetWindowTitle(title.str().c_str());
+	}
+
+	glutPostRedisplay();
+}
+
+
+void render() {
+	//The image is stored top row first, so draw it downwards from the top left corner
+	glClear(GL_COLOR_BUFFER_BIT);
+	glRasterPos2f(-1.0f, 1.0f);
+	glPixelZoom(1.0f, -1.0f);
+	glDrawPixels(WINDOW_WIDTH, WINDOW_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	glutSwapBuffers();
+}
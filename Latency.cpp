@@ -0,0 +1,82 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include "Latency.h"
+
+using namespace std;
+
+static const chrono::seconds latencyTimeout(2); //Presses not answered by then are dropped
+
+
+void inputLatency::keyPressed(int chip8Key, latencyHistogram& target) {
+	if (histogram != nullptr) {
+		return;
+	}
+
+	histogram = &target;
+	key = chip8Key;
+	pressed = chrono::steady_clock::now();
+	read = false;
+	drawn = false;
+}
+
+
+bool inputLatency::measuring() const {
+	return histogram != nullptr && !drawn;
+}
+
+
+void inputLatency::watch(chip8& machine, const function<void(chip8&, int)>& cycle) {
+	unsigned short opcode = machine.nextOpcode();
+
+	if (!read) {
+		int x = (opcode & 0x0F00) >> 8;
+		//EX9E / EXA1 and FX0A, decoded as emulateCycle() does (FX3A sets the pitch on XO-CHIP)
+		bool skip = (opcode & 0xF00F) == 0xE00E || (opcode & 0xF00F) == 0xE001;
+		bool wait = (opcode & 0xF00F) == 0xF00A && !(machine.isXoChip() && (opcode & 0x00F0) == 0x0030);
+		read = (skip && machine.V[x] == key) || (wait && machine.key[key] == 1);
+		cycle(machine, 1);
+		return;
+	}
+
+	unsigned long long before = machine.displayHash;
+	cycle(machine, 1);
+	drawn = (opcode & 0xF000) == 0xD000 && machine.displayHash != before;
+}
+
+
+void inputLatency::run(chip8& machine, int cycles, const function<void(chip8&, int)>& cycle) {
+	if (histogram != nullptr && chrono::steady_clock::now() - pressed > latencyTimeout) {
+		cancel();
+	}
+
+	int i = 0;
+	for (; i < cycles && measuring(); i++) {
+		watch(machine, cycle);
+	}
+	if (i < cycles) {
+		cycle(machine, cycles - i);
+	}
+}
+
+
+bool inputLatency::presented() {
+	if (histogram == nullptr || !drawn) {
+		return false;
+	}
+
+	histogram->record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - pressed).count());
+	cancel();
+	return true;
+}
+
+
+void inputLatency::cancel() {
+	histogram = nullptr;
+	read = false;
+	drawn = false;
+}
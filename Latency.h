@@ -0,0 +1,51 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include "Chip8.h"
+#include "Metrics.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Input-to-photon latency: the time from a key press in keyboardDown() to the first frame on screen that shows the game's
+response.
+
+keyPressed() stamps the press. From then on, run() steps the machine one opcode at a time and watches each opcode before it
+runs. The first EX9E/EXA1 that tests the key, or FX0A while the key is held, is the game reading it. The first DXYN after
+that which changes the display (displayHash) is the response. presented(), called once the frame has been swapped, then
+records the time since the press in the histogram handed to keyPressed(). Only one press is timed at a time. A press that
+gets no response within 2 seconds (released before it was read, or ignored) is dropped.
+
+Outside a measurement run() just runs the cycles. A probe copies like a value, so a fork run ahead of the machine can carry
+a copy of it.
+********************************************************************************************************************************/
+
+class inputLatency {
+	latencyHistogram* histogram = nullptr; //Where the measurement goes, nullptr when there is none
+	int key = 0;
+	chrono::steady_clock::time_point pressed;
+	bool read = false; //The game has read the key
+	bool drawn = false; //and drawn its response
+
+	void watch(chip8& machine, const function<void(chip8&, int)>& cycle); //Run one opcode through cycle, tagging it
+
+public:
+	void keyPressed(int chip8Key, latencyHistogram& target); //Start timing a press, unless one is being timed already
+
+	bool measuring() const; //A press is waiting for the game to answer it
+
+	//Run cycles opcodes with cycle(machine, count): one at a time while measuring(), then the rest in one go
+	void run(chip8& machine, int cycles, const function<void(chip8&, int)>& cycle);
+
+	bool presented(); //A frame was just put on screen. True if it showed the response, which is then recorded.
+
+	void cancel(); //Stop timing without recording anything
+};
@@ -6,22 +6,56 @@ Date: April 6 2020
 */
 
 #include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <chrono>
 #include <thread>
 #include <GL/freeglut.h>
 #include "Chip8.h"
+#include "Aot.h"
+#include "Audio.h"
+#include "Capture.h"
+#include "SharedFrame.h"
+#include "Trace.h"
+#include "Metrics.h"
+#include "FrameLoop.h"
+#include "Latency.h"
+#include "RomLibrary.h"
+#include "Timing.h"
 
 using namespace std;
 
 chip8 mychip8;
+aotRunner recompiled; //Runs the ROM's recompiled blocks when one was linked in (see Recompiler.cpp)
+unique_ptr<audioPipeline> audio; //The buzzer. Recorded to a WAV file with --wav <file>, otherwise discarded.
+unique_ptr<frameCapture> capture; //Every frame, when started with --capture <file>
+unique_ptr<framePublisher> publisher; //Shares every frame with FrameViewer processes, when started with --publish <name>
+unique_ptr<traceRing> trace; //Every opcode executed, when started with --trace <file>
+unique_ptr<tracer> traced; //Runs mychip8 in to trace
+unsigned long long cyclesRun = 0; //Cycle stamp for captured and published frames
+runtimeMetrics metrics; //Frame timing. Written to a file every second with --stats <file>, and to the console on SIGUSR1.
+unique_ptr<metricsReporter> reporter;
+std::chrono::steady_clock::time_point lastFrame; //When the previous runGame() started, for metrics
+int runAhead = 0; //Frames run ahead of mychip8 for the screen, set with --run-ahead <frames>
+chip8 ahead; //Fork of mychip8 run runAhead frames on with the keys held now. This is what the window shows.
+inputLatency latency; //Times key presses until the screen answers them, in metrics.inputLatency
+inputLatency aheadLatency; //The same measurement, carried through the run-ahead fork
+unique_ptr<frameLoop> loop; //Paces the frames on Linux. Elsewhere GLUT calls runGame() when idle.
+bool recording = false; //A WAV file or capture needs a frame every 18.5 ms, even while the machine is idle
+bool windowVisible = true; //No point drawing frames while the window is hidden
+const std::chrono::duration<double, milli> FRAME_TIME(18.5185185185); //10 cycles at 540Hz by default, see runGame()
 
 int window;
 int menuChoice = 0;
 string romName;
-string roms[] = {"","15PUZZLE","BLINKY","BRIX","CONNECT4","GUESS","HIDDEN","INVADERS","KALEID","MAZE","MERLIN","MISSILE","PONG","PONG2","PUZZLE","TANK","TETRIS","TICTAC","UFO","VERS","WIPEOFF"};
+frameTiming timing; //Opcodes each frame runs: the ROM library's speed, or the profile chosen with --timing fixed|vip|uncapped
+const char* keymap = DEFAULT_KEYMAP; //Host key for each Chip8 key, from the ROM library
 
 void renderPixels();
 void runGame();
+bool emulateFrame();
+void windowStatus(int state);
 void keyboardDown(unsigned char key, int x, int y);
 void keyboardUp(unsigned char key, int x, int y);
 void menu(int); //Switches rom based on menu choice
@@ -37,15 +71,99 @@ int main(int argc, char** argv) {
 	glutInitWindowSize(640, 320); //The size of the window
 	window = glutCreateWindow("CHIP-8");
 
+	//glutInit() has taken out its own arguments, so only ours are left
+	unique_ptr<audioSink> sink(new nullSink());
+	string statsPath;
+	for (int i = 1; i + 1 < argc; i++) {
+		if (string(argv[i]) == "--wav") {
+			wavSink* wav = new wavSink(argv[i + 1], 44100);
+			if (wav->isOpen()) {
+				sink.reset(wav);
+				recording = true;
+			}
+			else {
+				cout << "Could not create " << argv[i + 1] << endl;
+				delete wav;
+			}
+		}
+		else if (string(argv[i]) == "--capture") {
+			capture.reset(new frameCapture(argv[i + 1]));
+			if (capture->isOpen()) {
+				recording = true;
+			}
+			else {
+				cout << "Could not create " << argv[i + 1] << endl;
+				capture.reset();
+			}
+		}
+		else if (string(argv[i]) == "--publish") {
+			publisher.reset(new framePublisher(argv[i + 1]));
+			if (!publisher->isOpen()) {
+				cout << "Could not create shared memory segment " << argv[i + 1] << endl;
+				publisher.reset();
+			}
+		}
+		else if (string(argv[i]) == "--trace") {
+			trace.reset(new traceRing(1 << 16, argv[i + 1]));
+			if (trace->isOpen()) {
+				traced.reset(new tracer(mychip8, *trace));
+			}
+			else {
+				cout << "Could not create " << argv[i + 1] << endl;
+				trace.reset();
+			}
+		}
+		else if (string(argv[i]) == "--run-ahead") {
+			runAhead = max(0, min(atoi(argv[i + 1]), 8));
+		}
+		else if (string(argv[i]) == "--timing") {
+			timingProfile profile;
+			if (parseTimingProfile(argv[i + 1], profile)) {
+				timing.setProfile(profile);
+			}
+			else {
+				cout << "Unknown timing profile " << argv[i + 1] << ", use fixed, vip or uncapped" << endl;
+			}
+		}
+		else if (string(argv[i]) == "--stats") {
+			statsPath = argv[i + 1];
+		}
+	}
+	reporter.reset(new metricsReporter(metrics, statsPath));
+
+	//An uncapped frame already takes most of the frame time, so there is none left to run ahead with
+	if (runAhead > 0 && timing.getProfile() == TIMING_UNCAPPED) {
+		cout << "Run-ahead is not available with uncapped timing" << endl;
+		runAhead = 0;
+	}
+	audio.reset(new audioPipeline(move(sink)));
+
 	createMenu();
 
+	mychip8.setCore(CORE_THREADED);
+
 	//register callbacks
-	glutIdleFunc(runGame);
 	glutDisplayFunc(renderPixels); //glutDisplayFunc calls the render function
 	glutKeyboardFunc(keyboardDown);
 	glutKeyboardUpFunc(keyboardUp);
+	glutWindowStatusFunc(windowStatus);
+
+	//On Linux a timerfd wakes the loop at each frame deadline (see FrameLoop.h)
+	loop.reset(new frameLoop(std::chrono::duration_cast<std::chrono::nanoseconds>(FRAME_TIME)));
+	if (loop->isOpen()) {
+		loop->run([](long long late) {
+			metrics.sleepOvershoot.record(late > 0 ? late : 0);
+			if (emulateFrame()) {
+				return true;
+			}
+			lastFrame = {}; //Waiting for a key is not a slip
+			return false;
+		});
+	}
+	loop.reset();
 
 	//enter GLUT event processing cycle
+	glutIdleFunc(runGame);
 	glutMainLoop();
 
 	return 0;
@@ -61,26 +179,97 @@ void runGame() {
 	********************************************************************************************************************************/
 
 	start = std::chrono::system_clock::now();
-	
-	//Run a cycle of the emulation
-	for (int i = 0; i < 10; i++) {
-		mychip8.emulateCycle();
-	}
+
+	emulateFrame();
 	
 	endtime = std::chrono::system_clock::now();
 	std::chrono::duration<double,milli> elapsed = (endtime - start);
-	std::chrono::duration<double, milli> cycle(18.5185185185);
-	std::chrono::duration<double, milli> sleepTime = cycle - elapsed;
+	std::chrono::duration<double, milli> sleepTime = FRAME_TIME - elapsed;
 
+	auto sleepStart = std::chrono::steady_clock::now();
 	std::this_thread::sleep_for(sleepTime);
+	auto woke = std::chrono::steady_clock::now();
+
+	long long slept = std::chrono::duration_cast<std::chrono::nanoseconds>(woke - sleepStart).count();
+	long long asked = max(0LL, (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(sleepTime).count());
+	metrics.sleepOvershoot.record(slept > asked ? slept - asked : 0);
+}
+
+
+//One frame: the cycles timing allows, run-ahead, capture and publishing, the buzzer and the timers. False once the machine is idle.
+bool emulateFrame() {
+	auto frameStart = std::chrono::steady_clock::now();
+	
+	//Run a cycle of the emulation
+	int ran = timing.runFrame(mychip8, [](chip8& machine, int cycles) {
+		if (traced) {
+			traced->run(cycles);
+			return;
+		}
+		latency.run(machine, cycles, [](chip8& target, int count) {
+			if (recompiled.attached()) {
+				recompiled.run(target, count);
+			}
+			else {
+				target.runCycles(count);
+			}
+		});
+	});
+	cyclesRun += ran;
+
+	//Run-ahead: a game only reacts to a key on the frame after it polls it, so show the screen as it will be runAhead
+	//frames from now if the keys stay as they are. The fork shares every page with mychip8 until it writes to one, and is
+	//thrown away next frame. It runs on the interpreter, as the recompiled blocks keep track of the one machine they run.
+	//Each frame ahead runs as many opcodes as this one did.
+	if (runAhead > 0) {
+		ahead = mychip8.fork();
+		aheadLatency = latency;
+		for (int frame = 0; frame < runAhead; frame++) {
+			ahead.decreaseTimers(); //What the end of this frame will do to mychip8
+			aheadLatency.run(ahead, ran, [](chip8& machine, int cycles) { machine.runCycles(cycles); });
+		}
+	}
+	auto emulated = std::chrono::steady_clock::now();
+
+	if (capture) {
+		capture->frame(mychip8, cyclesRun);
+	}
+	if (publisher) {
+		publisher->publish(mychip8, cyclesRun);
+	}
 
+	//Record after the timed parts, so the bookkeeping lands in no measurement but the frame interval
+	if (lastFrame.time_since_epoch().count() != 0) {
+		auto interval = frameStart - lastFrame;
+		metrics.frameInterval.record(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+		if (interval > FRAME_TIME * 1.5) {
+			metrics.timerSlips.fetch_add(1, memory_order_relaxed);
+		}
+	}
+	lastFrame = frameStart;
+	metrics.frames.fetch_add(1, memory_order_relaxed);
+	metrics.cycles.fetch_add(ran, memory_order_relaxed);
+	metrics.instructions.record(ran * (1 + runAhead));
+	metrics.emulation.record(std::chrono::duration_cast<std::chrono::nanoseconds>(emulated - frameStart).count());
+
+	audio->frame(mychip8);
 	mychip8.decreaseTimers();
 	
-	glutPostRedisplay();
+	if (windowVisible) {
+		glutPostRedisplay();
+	}
+
+	return recording || !mychip8.idle();
+}
+
+
+void windowStatus(int state) {
+	windowVisible = state != GLUT_HIDDEN && state != GLUT_FULLY_COVERED;
 }
 
 
 void renderPixels(void) {
+	auto presentStart = std::chrono::steady_clock::now();
 
 	//Clears the color buffer (and depth buffer too?)
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -88,98 +277,82 @@ void renderPixels(void) {
 	//Set up the "screen" size?
 	glMatrixMode(GL_PROJECTION);
 	glLoadIdentity();
-	gluOrtho2D(0.0, 64.0, 32.0, 0.0);
+	chip8& shown = runAhead > 0 ? ahead : mychip8;
+	gluOrtho2D(0.0, shown.displayWidth(), shown.displayHeight(), 0.0); //64 x 32, or 128 x 64 in SUPER-CHIP hi-res mode
 
 	//Draw pixels
-	mychip8.drawPixels();
+	shown.drawPixels();
 
 	glutSwapBuffers();
+
+	//Close a key press's latency measurement on the first frame that shows the answer
+	if ((runAhead > 0 ? aheadLatency : latency).presented()) {
+		latency.cancel(); //Run-ahead showed it first; mychip8 only gets there later
+	}
+
+	metrics.present.record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - presentStart).count());
 }
 
 
 void keyboardDown(unsigned char key, int x, int y)
 {
-	if (key == '1')		    mychip8.key[0x1] = 1;
-	else if (key == '2')	mychip8.key[0x2] = 1;
-	else if (key == '3')	mychip8.key[0x3] = 1;
-	else if (key == '4')	mychip8.key[0xC] = 1;
-
-	else if (key == 'q')	mychip8.key[0x4] = 1;
-	else if (key == 'w')	mychip8.key[0x5] = 1;
-	else if (key == 'e')	mychip8.key[0x6] = 1;
-	else if (key == 'r')	mychip8.key[0xD] = 1;
-
-	else if (key == 'a')	mychip8.key[0x7] = 1;
-	else if (key == 's')	mychip8.key[0x8] = 1;
-	else if (key == 'd')	mychip8.key[0x9] = 1;
-	else if (key == 'f')	mychip8.key[0xE] = 1;
-
-	else if (key == 'z')	mychip8.key[0xA] = 1;
-	else if (key == 'x')	mychip8.key[0x0] = 1;
-	else if (key == 'c')	mychip8.key[0xB] = 1;
-	else if (key == 'v')	mychip8.key[0xF] = 1;
+	//The ROM's key layout (see RomLibrary.h)
+	const char* mapped = key != 0 ? strchr(keymap, key) : nullptr;
+	if (mapped == nullptr) {
+		return;
+	}
+	int chip8Key = (int)(mapped - keymap);
+
+	//Time a new press (not a key repeat) until the screen answers it
+	if (mychip8.key[chip8Key] == 0 && !romName.empty()) {
+		latency.keyPressed(chip8Key, metrics.inputLatencyFor(romName));
+	}
+	mychip8.key[chip8Key] = 1;
+
+	if (loop) {
+		loop->wake(); //The machine may be idle on FX0A
+	}
 }
 
 void keyboardUp(unsigned char key, int x, int y)
 {
-	if (key == '1')		    mychip8.key[0x1] = 0;
-	else if (key == '2')	mychip8.key[0x2] = 0;
-	else if (key == '3')	mychip8.key[0x3] = 0;
-	else if (key == '4')	mychip8.key[0xC] = 0;
-
-	else if (key == 'q')	mychip8.key[0x4] = 0;
-	else if (key == 'w')	mychip8.key[0x5] = 0;
-	else if (key == 'e')	mychip8.key[0x6] = 0;
-	else if (key == 'r')	mychip8.key[0xD] = 0;
-
-	else if (key == 'a')	mychip8.key[0x7] = 0;
-	else if (key == 's')	mychip8.key[0x8] = 0;
-	else if (key == 'd')	mychip8.key[0x9] = 0;
-	else if (key == 'f')	mychip8.key[0xE] = 0;
-
-	else if (key == 'z')	mychip8.key[0xA] = 0;
-	else if (key == 'x')	mychip8.key[0x0] = 0;
-	else if (key == 'c')	mychip8.key[0xB] = 0;
-	else if (key == 'v')	mychip8.key[0xF] = 0;
+	const char* mapped = key != 0 ? strchr(keymap, key) : nullptr;
+	if (mapped != nullptr) {
+		mychip8.key[mapped - keymap] = 0;
+	}
 }
 
-
 void menu(int num) {
 	if (num == 0) {
 		glutDestroyWindow(window);
 		exit(0);
 	}
-	else {
-		romName = roms[num];
-	}
+
+	//Bundled ROMs are already in memory, and the library says how to run them
+	const bundledRom& rom = bundledRoms[num - 1];
+	romInfo info = romInfoFor(rom.data, rom.size);
+	romName = rom.name;
+	timing.setCyclesPerFrame(info.cyclesPerFrame);
+	keymap = info.keymap;
 
 	mychip8.initialize();
-	mychip8.loadGame(romName);
+	mychip8.setQuirks(info.quirks);
+	mychip8.loadProgram(rom.data, rom.size);
+	recompiled.attach(mychip8, findAotProgram(mychip8));
+	latency.cancel();
+
+	if (loop) {
+		loop->wake();
+	}
 }
 
 void createMenu() {
 	glutCreateMenu(menu);
 
-	glutAddMenuEntry("15PUZZLE", 1);
-	glutAddMenuEntry("BLINKY", 2);
-	glutAddMenuEntry("BRIX", 3);
-	glutAddMenuEntry("CONNECT4", 4);
-	glutAddMenuEntry("GUESS", 5);
-	glutAddMenuEntry("HIDDEN", 6);
-	glutAddMenuEntry("INVADERS", 7);
-	glutAddMenuEntry("KALEID", 8);
-	glutAddMenuEntry("MAZE", 9);
-	glutAddMenuEntry("MERLIN", 10);
-	glutAddMenuEntry("MISSILE", 11);
-	glutAddMenuEntry("PONG", 12);
-	glutAddMenuEntry("PONG2", 13);
-	glutAddMenuEntry("PUZZLE", 14);
-	glutAddMenuEntry("TANK", 15);
-	glutAddMenuEntry("TETRIS", 16);
-	glutAddMenuEntry("TICTAC", 17);
-	glutAddMenuEntry("UFO", 18);
-	glutAddMenuEntry("VERS", 19);
-	glutAddMenuEntry("WIPEOFF", 20);
+	//One entry for each bundled ROM, numbered from 1
+	for (size_t i = 0; i < bundledRomCount; i++) {
+		glutAddMenuEntry(bundledRoms[i].name, (int)i + 1);
+	}
 	glutAddMenuEntry("Quit", 0);
 
 	glutAttachMenu(GLUT_RIGHT_BUTTON);
@@ -0,0 +1,194 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <csignal>
+#include <cstdio>
+#include <vector>
+#include "Metrics.h"
+
+using namespace std;
+
+//Set by SIGUSR1, cleared by the reporter thread once it has printed
+static volatile sig_atomic_t dumpRequested = 0;
+
+static void requestDump(int) {
+	dumpRequested = 1;
+}
+
+
+int latencyHistogram::bucketOf(unsigned long long value) {
+	if (value < SUB_BUCKETS) {
+		return (int)value;
+	}
+
+	int exponent = 63;
+	while ((value >> exponent) == 0) {
+		exponent--;
+	}
+
+	//The 4 bits below the leading one pick the sub-bucket
+	return (exponent - 3) * SUB_BUCKETS + (int)((value >> (exponent - 4)) & (SUB_BUCKETS - 1));
+}
+
+
+unsigned long long latencyHistogram::bucketTop(int bucket) {
+	if (bucket < SUB_BUCKETS) {
+		return (unsigned long long)bucket;
+	}
+
+	int exponent = bucket / SUB_BUCKETS + 3;
+	unsigned long long bottom = (unsigned long long)(SUB_BUCKETS + bucket % SUB_BUCKETS) << (exponent - 4);
+	return bottom + (1ull << (exponent - 4)) - 1;
+}
+
+
+latencyHistogram::latencyHistogram() {
+	for (int i = 0; i < BUCKETS; i++) {
+		counts[i].store(0, memory_order_relaxed);
+	}
+}
+
+
+unsigned long long latencyHistogram::count() const {
+	return total.load(memory_order_relaxed);
+}
+
+
+double latencyHistogram::mean() const {
+	unsigned long long n = count();
+	return n == 0 ? 0 : (double)sum.load(memory_order_relaxed) / n;
+}
+
+
+unsigned long long latencyHistogram::max() const {
+	return largest.load(memory_order_relaxed);
+}
+
+
+unsigned long long latencyHistogram::percentile(double p) const {
+	//Count the buckets first, so a record() landing half way through the walk cannot push the total out of reach
+	unsigned long long snapshot[BUCKETS];
+	unsigned long long n = 0;
+	for (int i = 0; i < BUCKETS; i++) {
+		snapshot[i] = counts[i].load(memory_order_relaxed);
+		n += snapshot[i];
+	}
+
+	unsigned long long rank = (unsigned long long)(p / 100 * n + 0.5);
+	unsigned long long seen = 0;
+	for (int i = 0; i < BUCKETS; i++) {
+		seen += snapshot[i];
+		if (seen >= rank && seen > 0) {
+			return bucketTop(i) < max() ? bucketTop(i) : max();
+		}
+	}
+	return 0;
+}
+
+
+//Microseconds from nanoseconds, for the report
+static double us(double ns) {
+	return ns / 1000;
+}
+
+
+latencyHistogram& runtimeMetrics::inputLatencyFor(const string& rom) {
+	int count = latencyRoms.load(memory_order_relaxed);
+	for (int i = 0; i < count; i++) {
+		if (rom.compare(0, sizeof(latencyRom[i]) - 1, latencyRom[i]) == 0) {
+			return inputLatency[i];
+		}
+	}
+
+	if (count == LATENCY_ROMS) {
+		return inputLatency[LATENCY_ROMS - 1];
+	}
+
+	rom.copy(latencyRom[count], sizeof(latencyRom[count]) - 1);
+	latencyRoms.store(count + 1, memory_order_release);
+	return inputLatency[count];
+}
+
+
+void runtimeMetrics::write(ostream& out) const {
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	out << fixed << setprecision(1);
+	out << "uptime_seconds " << seconds << endl;
+	out << "frames " << frames.load(memory_order_relaxed) << endl;
+	out << "cycles " << cycles.load(memory_order_relaxed) << endl;
+	out << "cycles_per_second " << cycles.load(memory_order_relaxed) / (seconds > 0 ? seconds : 1) << endl;
+	out << "frames_per_second " << frames.load(memory_order_relaxed) / (seconds > 0 ? seconds : 1) << endl;
+	out << "timer_slips " << timerSlips.load(memory_order_relaxed) << endl;
+
+	out << "#histogram count mean p50 p90 p99 p99.9 max" << endl;
+	vector<const latencyHistogram*> timings = { &emulation, &sleepOvershoot, &present, &frameInterval };
+	vector<string> names = { "emulation_us", "sleep_overshoot_us", "present_us", "frame_interval_us" };
+	int roms = latencyRoms.load(memory_order_acquire);
+	for (int i = 0; i < roms; i++) {
+		timings.push_back(&inputLatency[i]);
+		names.push_back("input_latency_us[" + string(latencyRom[i]) + "]");
+	}
+
+	for (size_t i = 0; i < timings.size(); i++) {
+		const latencyHistogram& h = *timings[i];
+		out << names[i] << " " << h.count() << " " << us(h.mean()) << " " << us((double)h.percentile(50)) << " "
+			<< us((double)h.percentile(90)) << " " << us((double)h.percentile(99)) << " " << us((double)h.percentile(99.9)) << " "
+			<< us((double)h.max()) << endl;
+	}
+	out << "instructions_per_frame " << instructions.count() << " " << instructions.mean() << " " << instructions.percentile(50)
+		<< " " << instructions.percentile(90) << " " << instructions.percentile(99) << " " << instructions.percentile(99.9) << " "
+		<< instructions.max() << endl;
+
+	out << defaultfloat;
+}
+
+
+metricsReporter::metricsReporter(const runtimeMetrics& source, const string& statsPath) : metrics(source), path(statsPath) {
+#ifdef SIGUSR1
+	signal(SIGUSR1, requestDump);
+#endif
+	reporter = thread(&metricsReporter::report, this);
+}
+
+
+metricsReporter::~metricsReporter() {
+	stopping.store(true, memory_order_relaxed);
+	reporter.join();
+}
+
+
+void metricsReporter::report() {
+	auto nextWrite = chrono::steady_clock::now() + chrono::seconds(1);
+
+	while (!stopping.load(memory_order_relaxed)) {
+		this_thread::sleep_for(chrono::milliseconds(100));
+
+		if (dumpRequested) {
+			dumpRequested = 0;
+			metrics.write(cout);
+			cout << flush;
+		}
+
+		if (!path.empty() && chrono::steady_clock::now() >= nextWrite) {
+			nextWrite += chrono::seconds(1);
+
+			string temporary = path + ".tmp";
+			{
+				ofstream file(temporary, ios::out | ios::trunc);
+				metrics.write(file);
+			}
+#ifdef _WIN32
+			remove(path.c_str()); //rename() will not replace a file on Windows
+#endif
+			rename(temporary.c_str(), path.c_str());
+		}
+	}
+}
@@ -0,0 +1,112 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Runtime metrics: how runGame() keeps time. The emulation thread only ever does relaxed atomic adds on fixed arrays, never
+allocates, locks or formats anything; a reporter thread reads the counters and writes them out, so measuring does not move
+the timing being measured.
+
+Latencies go in to log-linear (HDR-style) histograms: values below 16 are counted exactly, and each power of two above that
+is split in to 16 buckets, so every recorded value is kept to within 1/16 (about 6%) from nanoseconds up to centuries.
+
+The reporter rewrites a stats file every second (written to a temporary name and renamed over the old one, so readers never
+see half a file), and prints the same report to standard output whenever the process gets SIGUSR1.
+********************************************************************************************************************************/
+
+class latencyHistogram {
+public:
+	static const int SUB_BUCKETS = 16;
+	static const int BUCKETS = (64 - 3) * SUB_BUCKETS;
+
+private:
+	atomic<unsigned long long> counts[BUCKETS];
+	atomic<unsigned long long> total{ 0 };
+	atomic<unsigned long long> sum{ 0 };
+	atomic<unsigned long long> largest{ 0 };
+
+	static int bucketOf(unsigned long long value);
+
+	static unsigned long long bucketTop(int bucket); //Largest value that falls in bucket
+
+public:
+	latencyHistogram();
+
+	void record(unsigned long long value) {
+		counts[bucketOf(value)].fetch_add(1, memory_order_relaxed);
+		total.fetch_add(1, memory_order_relaxed);
+		sum.fetch_add(value, memory_order_relaxed);
+
+		unsigned long long seen = largest.load(memory_order_relaxed);
+		while (value > seen && !largest.compare_exchange_weak(seen, value, memory_order_relaxed)) {
+		}
+	}
+
+	unsigned long long count() const;
+
+	double mean() const;
+
+	unsigned long long max() const;
+
+	unsigned long long percentile(double p) const; //Upper edge of the bucket holding the p-th percentile (0 - 100)
+};
+
+const int LATENCY_ROMS = 32; //ROMs input latency is kept apart for
+
+struct runtimeMetrics {
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+
+	atomic<unsigned long long> frames{ 0 };
+	atomic<unsigned long long> cycles{ 0 };
+	atomic<unsigned long long> timerSlips{ 0 }; //Frames that started more than half a frame late, so decreaseTimers() fell behind
+
+	latencyHistogram emulation; //ns spent running a frame's opcodes
+	latencyHistogram sleepOvershoot; //ns a frame started past its deadline: sleep_for() oversleeping, or the frame timer waking late
+	latencyHistogram present; //ns renderPixels() took to draw and swap
+	latencyHistogram frameInterval; //ns from the start of one frame to the start of the next
+	latencyHistogram instructions; //Opcodes run per frame
+
+	//ns from a key press to the first frame on screen that answers it, by ROM (see Latency.h). A slot's name is written
+	//before latencyRoms counts it, so the reporter only reads names that are complete.
+	char latencyRom[LATENCY_ROMS][16] = {};
+	latencyHistogram inputLatency[LATENCY_ROMS];
+	atomic<int> latencyRoms{ 0 };
+
+	//The input latency histogram for rom, added the first time it is asked for. Call it from the emulation thread only.
+	//ROMs past LATENCY_ROMS all share the last one.
+	latencyHistogram& inputLatencyFor(const string& rom);
+
+	void write(ostream& out) const; //Plain text report, one metric a line
+};
+
+//Writes a runtimeMetrics out from a background thread
+class metricsReporter {
+	const runtimeMetrics& metrics;
+	string path;
+	thread reporter;
+	atomic<bool> stopping{ false };
+
+	void report(); //Reporter thread
+
+public:
+	//Rewrite path (if not empty) every second. SIGUSR1 prints the report to standard output.
+	metricsReporter(const runtimeMetrics& source, const string& statsPath);
+
+	~metricsReporter();
+
+	metricsReporter(const metricsReporter&) = delete;
+	metricsReporter& operator=(const metricsReporter&) = delete;
+};
@@ -0,0 +1,169 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Pre-decoded interpreter core. Every address is decoded once, the first time it is executed, and the result is kept in
+decoded[] until storeMemory() overwrites one of its bytes. While decoding, a few sequences that ROMs run over and over are
+recognized and turned in to superinstructions, which do the work of 2 or 3 opcodes in a single dispatch.
+********************************************************************************************************************************/
+
+#include "Chip8Ops.h"
+
+using namespace std;
+
+
+void chip8::clearDecoded()
+{
+	//assign() drops pages shared with a fork for fresh ones, so clearing never copies them
+	decodedOp cleared = decodedOp();
+	cleared.handler = threadedMiss;
+	decoded.assign(decoded.size(), cleared);
+}
+
+
+void chip8::decode(unsigned short address)
+{
+	decodedOp& d = decoded.writable(address);
+	d = decodeOpcode(memory[address] << 8 | memory[(address + 1) & memoryMask], xoChip);
+	d.handler = threadedMiss;
+
+	//F000 NNNN carries its address in the next two bytes. Writing them drops this decoding too (see storeMemory()).
+	if (d.op == OP_LD_I_LONG) {
+		d.nnn = memory[(address + 2) & memoryMask] << 8 | memory[(address + 3) & memoryMask];
+		return;
+	}
+
+	if (address + 3 > memoryMask) {
+		return;
+	}
+
+	unsigned short opcode1 = memory[address + 2] << 8 | memory[address + 3];
+	decodedOp next1 = decodeOpcode(opcode1, xoChip);
+
+	if (d.op == OP_LD_I && next1.op == OP_DRW) {
+		d.fused = FUSED_LD_I_DRW;
+	}
+	else if (address + 5 <= memoryMask) {
+		unsigned short opcode2 = memory[address + 4] << 8 | memory[address + 5];
+		decodedOp next2 = decodeOpcode(opcode2, xoChip);
+
+		if (d.op == OP_LD_BYTE && next1.op == OP_LD_BYTE && next2.op == OP_DRW) {
+			d.fused = FUSED_LD_LD_DRW;
+		}
+		else if (d.op == OP_ADD_BYTE && next1.op == OP_SE_BYTE && next2.op == OP_JP) {
+			d.fused = FUSED_ADD_SE_JP;
+		}
+		else if (d.op == OP_LD_VX_DT && next1.op == OP_SE_BYTE && next2.op == OP_JP) {
+			d.fused = FUSED_LD_DT_SE_JP;
+		}
+	}
+
+	//Superinstructions read the decodings of the opcodes they cover, so make sure those exist
+	if (d.fused != FUSED_NONE) {
+		for (int i = 1; i < fusedLength[d.fused]; i++) {
+			if (decoded[address + i * 2].op == OP_UNDECODED) {
+				decode(address + i * 2);
+			}
+		}
+	}
+}
+
+
+template <typename Quirks>
+void chip8::runPredecoded(int cycles)
+{
+	typedef chip8Ops<Quirks> ops;
+
+	while (cycles > 0) {
+		unsigned short address = pc & memoryMask;
+
+		if (decoded[address].op == OP_UNDECODED) {
+			decode(address);
+		}
+
+		const decodedOp& d = decoded[address];
+
+		//A superinstruction only runs when the whole sequence fits in the cycles left, so the cycle count stays exact
+		if (d.fused != FUSED_NONE && cycles >= fusedLength[d.fused]) {
+			switch (d.fused) {
+			case FUSED_LD_LD_DRW: cycles -= ops::ldLdDrw(*this, d, decoded[address + 2], decoded[address + 4]); continue;
+			case FUSED_LD_I_DRW: cycles -= ops::ldIDrw(*this, d, decoded[address + 2]); continue;
+			case FUSED_ADD_SE_JP: cycles -= ops::addSeJp(*this, d, decoded[address + 2], decoded[address + 4]); continue;
+			case FUSED_LD_DT_SE_JP: cycles -= ops::ldDtSeJp(*this, d, decoded[address + 2], decoded[address + 4]); continue;
+			}
+		}
+
+		switch (d.op) {
+		case OP_CLS: ops::cls(*this, d); break;
+		case OP_RET: ops::ret(*this, d); break;
+		case OP_JP: ops::jp(*this, d); break;
+		case OP_CALL: ops::call(*this, d); break;
+		case OP_SE_BYTE: ops::seByte(*this, d); break;
+		case OP_SNE_BYTE: ops::sneByte(*this, d); break;
+		case OP_SE_REG: ops::seReg(*this, d); break;
+		case OP_LD_BYTE: ops::ldByte(*this, d); break;
+		case OP_ADD_BYTE: ops::addByte(*this, d); break;
+		case OP_LD_REG: ops::ldReg(*this, d); break;
+		case OP_OR: ops::orReg(*this, d); break;
+		case OP_AND: ops::andReg(*this, d); break;
+		case OP_XOR: ops::xorReg(*this, d); break;
+		case OP_ADD_REG: ops::addReg(*this, d); break;
+		case OP_SUB: ops::sub(*this, d); break;
+		case OP_SHR: ops::shr(*this, d); break;
+		case OP_SUBN: ops::subn(*this, d); break;
+		case OP_SHL: ops::shl(*this, d); break;
+		case OP_SNE_REG: ops::sneReg(*this, d); break;
+		case OP_LD_I: ops::ldI(*this, d); break;
+		case OP_JP_V0: ops::jpV0(*this, d); break;
+		case OP_RND: ops::rnd(*this, d); break;
+		case OP_DRW: ops::drw(*this, d); break;
+		case OP_SKP: ops::skp(*this, d); break;
+		case OP_SKNP: ops::sknp(*this, d); break;
+		case OP_LD_VX_DT: ops::ldVxDt(*this, d); break;
+		case OP_LD_KEY: ops::ldKey(*this, d); break;
+		case OP_LD_DT: ops::ldDt(*this, d); break;
+		case OP_LD_ST: ops::ldSt(*this, d); break;
+		case OP_ADD_I: ops::addI(*this, d); break;
+		case OP_LD_FONT: ops::ldFont(*this, d); break;
+		case OP_BCD: ops::bcd(*this, d); break;
+		case OP_STORE: ops::store(*this, d); break;
+		case OP_LOAD: ops::load(*this, d); break;
+		case OP_SCD: ops::scd(*this, d); break;
+		case OP_SCR: ops::scr(*this, d); break;
+		case OP_SCL: ops::scl(*this, d); break;
+		case OP_LOW: ops::low(*this, d); break;
+		case OP_HIGH: ops::high(*this, d); break;
+		case OP_LD_BIG_FONT: ops::ldBigFont(*this, d); break;
+		case OP_SAVE_FLAGS: ops::saveFlags(*this, d); break;
+		case OP_LOAD_FLAGS: ops::loadFlags(*this, d); break;
+		case OP_SCU: ops::scu(*this, d); break;
+		case OP_SAVE_RANGE: ops::saveRange(*this, d); break;
+		case OP_LOAD_RANGE: ops::loadRange(*this, d); break;
+		case OP_LD_I_LONG: ops::ldILong(*this, d); break;
+		case OP_PLANE: ops::plane(*this, d); break;
+		case OP_AUDIO: ops::audio(*this, d); break;
+		case OP_PITCH: ops::pitch(*this, d); break;
+		default: break; //OP_STALL
+		}
+
+		cycles--;
+	}
+}
+
+
+template <size_t... Flags>
+const chip8::runFunction* chip8::predecodedTable(index_sequence<Flags...>)
+{
+	static const runFunction table[] = { &chip8::runPredecoded<quirks<Flags>>... };
+	return table;
+}
+
+
+const chip8::runFunction* chip8::predecodedCores()
+{
+	return predecodedTable(make_index_sequence<QUIRK_COUNT>());
+}
@@ -0,0 +1,15 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include "Quirks.h"
+#include "RomLibrary.h"
+
+unsigned quirksForRom(string romName) {
+	//The quirk sets are kept with the rest of what is known about each ROM (see RomLibrary.h)
+	const romInfo* known = findRom(romName);
+	return known != nullptr ? known->quirks : QUIRKS_DEFAULT;
+}
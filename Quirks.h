@@ -0,0 +1,42 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <string>
+
+using namespace std;
+
+//Behaviours where CHIP-8 variants disagree. Each quirk is one bit of a quirk set.
+enum quirkFlags : unsigned {
+	QUIRK_SHIFT_VY = 0x01, //8XY6/8XYE shift Vy into Vx (COSMAC VIP) instead of shifting Vx in place
+	QUIRK_LOAD_STORE_I = 0x02, //FX55/FX65 leave I pointing past the last register copied
+	QUIRK_JUMP_VX = 0x04, //BNNN is BXNN: jump to XNN + Vx instead of NNN + V0
+	QUIRK_CLIP_SPRITES = 0x08, //DXYN clips sprites at the screen edges instead of wrapping them
+	QUIRK_VF_RESET = 0x10, //8XY1/8XY2/8XY3 reset VF to 0
+};
+
+const unsigned QUIRK_COUNT = 32; //Number of distinct quirk sets (every combination of the flags above)
+
+//Named quirk sets
+const unsigned QUIRKS_DEFAULT = 0; //The behaviour this emulator has always had
+const unsigned QUIRKS_COSMAC_VIP = QUIRK_SHIFT_VY | QUIRK_LOAD_STORE_I | QUIRK_CLIP_SPRITES | QUIRK_VF_RESET;
+const unsigned QUIRKS_SUPERCHIP = QUIRK_JUMP_VX | QUIRK_CLIP_SPRITES;
+
+//Compile-time quirk policy. The interpreter is instantiated once per quirk set, so every
+//quirk check is resolved by the compiler and costs nothing in the emulation loop.
+template <unsigned Flags>
+struct quirks {
+	static constexpr unsigned flags = Flags;
+	static constexpr bool shiftVy = (Flags & QUIRK_SHIFT_VY) != 0;
+	static constexpr bool loadStoreIncrementsI = (Flags & QUIRK_LOAD_STORE_I) != 0;
+	static constexpr bool jumpVx = (Flags & QUIRK_JUMP_VX) != 0;
+	static constexpr bool clipSprites = (Flags & QUIRK_CLIP_SPRITES) != 0;
+	static constexpr bool vfReset = (Flags & QUIRK_VF_RESET) != 0;
+};
+
+unsigned quirksForRom(string romName); //Returns the quirk set a ROM was written for (QUIRKS_DEFAULT if unknown)
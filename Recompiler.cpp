@@ -0,0 +1,302 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Ahead-of-time recompiler: turns a ROM in to a C++ translation unit for the runtime in Aot.h.
+
+Usage: Recompiler <rom> <output.cpp> [quirk flags]
+
+Starting at 0x200, every instruction reachable through jumps, calls and skips is found and the code is split in to basic
+blocks. Each block becomes one function, and a table of all blocks lets the runtime dispatch returns and BNNN jumps.
+Compile the output together with the emulator; the block table registers itself and is picked up whenever the same ROM is
+loaded with the same quirk set. Instructions the blocks cannot reproduce exactly (FX0A, opcodes the interpreter does not
+know) are left to the interpreter.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "Quirks.h"
+#include "RomAnalysis.h"
+
+using namespace std;
+
+string hex4(unsigned value) {
+	ostringstream out;
+	out << "0x" << hex << uppercase << setw(4) << setfill('0') << value;
+	return out.str();
+}
+
+string hex2(unsigned value) {
+	ostringstream out;
+	out << "0x" << hex << uppercase << setw(2) << setfill('0') << value;
+	return out.str();
+}
+
+string reg(unsigned index) {
+	ostringstream out;
+	out << "s.V[0x" << hex << uppercase << index << "]";
+	return out.str();
+}
+
+
+//Emits the C++ for one instruction. Terminators also set s.pc.
+void emitInstruction(ostream& out, unsigned short address, unsigned short opcode, unsigned quirkSet) {
+	unsigned x = (opcode & 0x0F00) >> 8;
+	unsigned y = (opcode & 0x00F0) >> 4;
+	unsigned n = opcode & 0x000F;
+	unsigned kk = opcode & 0x00FF;
+	unsigned nnn = opcode & 0x0FFF;
+	string vx = reg(x);
+	string vy = reg(y);
+
+	out << "\t//" << hex4(address) << ": " << hex << uppercase << setw(4) << setfill('0') << opcode << dec << "\n";
+
+	auto skip = [&](const string& condition) {
+		out << "\tif (" << condition << ") {\n\t\ts.pc = " << hex4(address + 4) << ";\n\t}\n\telse {\n\t\ts.pc = " << hex4(address + 2) << ";\n\t}\n";
+	};
+
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		if ((opcode & 0xFFF0) == 0x00C0) {
+			out << "\taotRuntime::scrollDown(s, " << n << ");\n";
+		}
+		else if (opcode == 0x00FB) {
+			out << "\taotRuntime::scrollRight(s);\n";
+		}
+		else if (opcode == 0x00FC) {
+			out << "\taotRuntime::scrollLeft(s);\n";
+		}
+		else if (opcode == 0x00FE || opcode == 0x00FF) {
+			out << "\taotRuntime::setHires(s, " << (opcode == 0x00FF ? "true" : "false") << ");\n";
+		}
+		else if (n == 0x0) {
+			out << "\taotRuntime::clearScreen(s);\n";
+		}
+		else {
+			out << "\ts.stack_pointer--;\n\ts.pc = s.stack[s.stack_pointer] + 2;\n";
+		}
+		break;
+	case 0x1000: out << "\ts.pc = " << hex4(nnn) << ";\n"; break;
+	case 0x2000: out << "\ts.stack[s.stack_pointer] = " << hex4(address) << ";\n\ts.stack_pointer++;\n\ts.pc = " << hex4(nnn) << ";\n"; break;
+	case 0x3000: skip(vx + " == " + hex2(kk)); break;
+	case 0x4000: skip(vx + " != " + hex2(kk)); break;
+	case 0x5000: skip(vx + " == " + vy); break;
+	case 0x6000: out << "\t" << vx << " = " << hex2(kk) << ";\n"; break;
+	case 0x7000: out << "\t" << vx << " += " << hex2(kk) << ";\n"; break;
+	case 0x8000:
+		switch (n) {
+		case 0x0: out << "\t" << vx << " = " << vy << ";\n"; break;
+		case 0x1: out << "\t" << vx << " |= " << vy << ";\n"; break;
+		case 0x2: out << "\t" << vx << " &= " << vy << ";\n"; break;
+		case 0x3: out << "\t" << vx << " ^= " << vy << ";\n"; break;
+		case 0x4:
+			out << "\t" << vx << " = " << vx << " + " << vy << ";\n";
+			out << "\ts.V[0xF] = (" << vy << " > (0xFF - " << vx << ")) ? 1 : 0;\n";
+			break;
+		case 0x5:
+			out << "\ts.V[0xF] = (" << vx << " > " << vy << ") ? 1 : 0;\n";
+			out << "\t" << vx << " = " << vx << " - " << vy << ";\n";
+			break;
+		case 0x6:
+		{
+			string source = (quirkSet & QUIRK_SHIFT_VY) ? vy : vx;
+			out << "\t{\n\t\tunsigned char source = " << source << ";\n\t\ts.V[0xF] = source & 1;\n\t\t" << vx << " = source >> 1;\n\t}\n";
+		}
+		break;
+		case 0x7:
+			out << "\ts.V[0xF] = (" << vy << " > " << vx << ") ? 1 : 0;\n";
+			out << "\t" << vx << " = " << vy << " - " << vx << ";\n";
+			break;
+		case 0xE:
+		{
+			string source = (quirkSet & QUIRK_SHIFT_VY) ? vy : vx;
+			out << "\t{\n\t\tunsigned char source = " << source << ";\n\t\ts.V[0xF] = source >> 7;\n\t\t" << vx << " = source << 1;\n\t}\n";
+		}
+		break;
+		}
+		if ((quirkSet & QUIRK_VF_RESET) && n >= 0x1 && n <= 0x3) {
+			out << "\ts.V[0xF] = 0;\n";
+		}
+		break;
+	case 0x9000: skip(vx + " != " + vy); break;
+	case 0xA000: out << "\ts.I = " << hex4(nnn) << ";\n"; break;
+	case 0xB000:
+		if (quirkSet & QUIRK_JUMP_VX) {
+			out << "\ts.pc = " << hex4(nnn) << " + " << vx << ";\n";
+		}
+		else {
+			out << "\ts.pc = " << hex4(nnn) << " + s.V[0x0];\n";
+		}
+		break;
+	case 0xC000: out << "\t" << vx << " = aotRuntime::randomByte(s) & " << hex2(kk) << ";\n"; break;
+	case 0xD000:
+		out << "\taotRuntime::drawSprite(s, " << vx << ", " << vy << ", " << n << ", " << ((quirkSet & QUIRK_CLIP_SPRITES) ? "true" : "false") << ");\n";
+		break;
+	case 0xE000:
+		if (n == 0xE) {
+			skip("s.key[" + vx + "] == 1");
+		}
+		else {
+			skip("s.key[" + vx + "] == 0");
+		}
+		break;
+	case 0xF000:
+		switch (n) {
+		case 0x7: out << "\t" << vx << " = s.delay_timer;\n"; break;
+		case 0x8: out << "\ts.sound_timer = " << vx << ";\n"; break;
+		case 0xE:
+			out << "\ts.V[0xF] = (s.I + " << vx << " > 0xFFF) ? 1 : 0;\n";
+			out << "\ts.I += " << vx << ";\n";
+			break;
+		case 0x9: out << "\ts.I = " << vx << " * 5;\n"; break;
+		case 0x0: out << "\ts.I = BIG_FONT_ADDRESS + (" << vx << " & 0xF) * 10;\n"; break;
+		case 0x3:
+			out << "\taotRuntime::store(s, s.I, " << vx << " / 100);\n";
+			out << "\taotRuntime::store(s, s.I + 1, (" << vx << " / 10) % 10);\n";
+			out << "\taotRuntime::store(s, s.I + 2, " << vx << " % 10);\n";
+			break;
+		case 0x5:
+			if (y == 0x1) {
+				out << "\ts.delay_timer = " << vx << ";\n";
+			}
+			else if (y == 0x5) {
+				for (unsigned j = 0; j <= x; j++) {
+					out << "\taotRuntime::store(s, s.I + " << j << ", " << reg(j) << ");\n";
+				}
+			}
+			else if (y == 0x7) {
+				out << "\taotRuntime::saveFlags(s, " << x << ");\n";
+			}
+			else if (y == 0x8) {
+				out << "\taotRuntime::loadFlags(s, " << x << ");\n";
+			}
+			else {
+				for (unsigned j = 0; j <= x; j++) {
+					out << "\t" << reg(j) << " = s.memory[(s.I + " << j << ") & 0xFFF];\n";
+				}
+			}
+			if ((y == 0x5 || y == 0x6) && (quirkSet & QUIRK_LOAD_STORE_I)) {
+				out << "\ts.I += " << (x + 1) << ";\n";
+			}
+			break;
+		}
+		break;
+	}
+}
+
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		cout << "Usage: Recompiler <rom> <output.cpp> [quirk flags]" << endl;
+		return 1;
+	}
+
+	string romPath = argv[1];
+	unsigned quirkSet = (argc > 3) ? strtoul(argv[3], nullptr, 0) % QUIRK_COUNT : quirksForRom(romPath);
+
+	vector<unsigned char> rom;
+	if (!readRomFile(romPath, rom)) {
+		cout << "Could not read a CHIP-8 ROM from " << romPath << endl;
+		return 1;
+	}
+
+	romAnalysis analysis = analyzeRom(rom);
+
+	//FX0A and opcodes the interpreter does not know are left to the interpreter
+	auto compilable = [&](unsigned address) {
+		instructionKind kind = classifyInstruction(analysis.opcodeAt(address));
+		return kind != KIND_WAIT && kind != KIND_STALL;
+	};
+
+	//Name the program after the ROM file
+	string name = romPath.substr(romPath.find_last_of("/\\") + 1);
+	string symbol = "aot_";
+	for (char c : name) {
+		symbol += isalnum((unsigned char)c) ? c : '_';
+	}
+
+	ostringstream blocks; //Block functions
+	ostringstream table; //aotBlock entries
+	int blockCount = 0;
+
+	for (const basicBlock& block : analysis.blocks) {
+		if (!compilable(block.start)) {
+			continue;
+		}
+
+		blocks << "static void block_" << hex << uppercase << setw(4) << setfill('0') << block.start << dec << "(aotState& s)\n{\n";
+
+		unsigned address = block.start;
+		unsigned length = 0;
+
+		while (length < block.length) {
+			unsigned short opcode = analysis.opcodeAt(address);
+
+			if (!compilable(address)) {
+				break;
+			}
+
+			emitInstruction(blocks, address, opcode, quirkSet);
+			length++;
+			address += 2;
+		}
+
+		//Blocks that fall through or stop before an interpreted instruction continue at the next address.
+		//FX33/FX55 end their block too, so a write over code is noticed before the next block runs.
+		instructionKind last = classifyInstruction(analysis.opcodeAt(address - 2));
+		if (last == KIND_STRAIGHT || last == KIND_STORE) {
+			blocks << "\ts.pc = " << hex4(address) << ";\n";
+		}
+
+		blocks << "}\n\n";
+
+		table << "\t{ " << hex4(block.start) << ", " << length << ", block_" << hex << uppercase << setw(4) << setfill('0') << block.start << dec << " },\n";
+		blockCount++;
+	}
+
+	//Every byte of every reached instruction, merged in to ranges
+	ostringstream code;
+	int codeRangeCount = 0;
+
+	for (unsigned address = 0; address < 4096;) {
+		if (analysis.bytes[address] != BYTE_CODE) {
+			address++;
+			continue;
+		}
+
+		unsigned start = address;
+		while (address < 4096 && analysis.bytes[address] == BYTE_CODE) {
+			address++;
+		}
+
+		code << "\t{ " << hex4(start) << ", " << hex4(address) << " },\n";
+		codeRangeCount++;
+	}
+
+	ofstream output(argv[2]);
+	if (!output) {
+		cout << "Could not write " << argv[2] << endl;
+		return 1;
+	}
+
+	output << "//Generated by Recompiler from " << name << " (quirk set " << quirkSet << "). Do not edit.\n\n";
+	output << "#include \"Aot.h\"\n\n";
+	output << blocks.str();
+	output << "static const aotBlock blocks[] = {\n" << table.str() << "};\n\n";
+	output << "static const aotCodeRange code[] = {\n" << code.str() << "};\n\n";
+	output << "static const aotProgram " << symbol << " = { \"" << name << "\", 0x" << hex << uppercase << hashRom(rom.data(), rom.size()) << dec
+		<< "ull, " << rom.size() << ", " << quirkSet << ", blocks, " << blockCount << ", code, " << codeRangeCount << " };\n\n";
+	output << "static aotRegistration registration(&" << symbol << ");\n";
+
+	cout << name << ": " << blockCount << " blocks written to " << argv[2] << endl;
+	return 0;
+}
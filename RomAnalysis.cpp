@@ -0,0 +1,456 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include "RomAnalysis.h"
+
+using namespace std;
+
+
+//Formats value as 0x followed by digits upper-case hex digits
+static string hexString(unsigned long long value, int digits) {
+	ostringstream out;
+	out << "0x" << hex << uppercase << setw(digits) << setfill('0') << value;
+	return out.str();
+}
+
+static string registerName(unsigned index) {
+	ostringstream out;
+	out << "V" << hex << uppercase << index;
+	return out.str();
+}
+
+
+instructionKind classifyInstruction(unsigned short opcode) {
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		if ((opcode & 0xFFF0) == 0x00C0) return KIND_STRAIGHT; //SUPER-CHIP scroll down
+		if (opcode == 0x00FB || opcode == 0x00FC || opcode == 0x00FE || opcode == 0x00FF) return KIND_STRAIGHT; //Scrolls and resolution
+		if (opcode == 0x00FD) return KIND_STALL; //Exit
+		if ((opcode & 0x000F) == 0x0000) return KIND_STRAIGHT;
+		if ((opcode & 0x000F) == 0x000E) return KIND_RETURN;
+		return KIND_STALL;
+	case 0x1000: return KIND_JUMP;
+	case 0x2000: return KIND_CALL;
+	case 0x3000:
+	case 0x4000:
+	case 0x5000:
+	case 0x9000: return KIND_SKIP;
+	case 0xB000: return KIND_INDIRECT;
+	case 0x8000:
+		if ((opcode & 0x000F) <= 0x0007 || (opcode & 0x000F) == 0x000E) return KIND_STRAIGHT;
+		return KIND_STALL;
+	case 0xE000:
+		if ((opcode & 0x000F) == 0x000E || (opcode & 0x000F) == 0x0001) return KIND_SKIP;
+		return KIND_STALL;
+	case 0xF000:
+		switch (opcode & 0x000F) {
+		case 0x0007:
+		case 0x0008:
+		case 0x0009:
+		case 0x000E: return KIND_STRAIGHT;
+		case 0x0003: return KIND_STORE;
+		case 0x000A: return KIND_WAIT;
+		case 0x0000:
+			if ((opcode & 0x00F0) == 0x0030) return KIND_STRAIGHT;
+			return KIND_STALL;
+		case 0x0005:
+			if ((opcode & 0x00F0) == 0x0010 || (opcode & 0x00F0) == 0x0060) return KIND_STRAIGHT;
+			if ((opcode & 0x00F0) == 0x0070 || (opcode & 0x00F0) == 0x0080) return KIND_STRAIGHT;
+			if ((opcode & 0x00F0) == 0x0050) return KIND_STORE;
+			return KIND_STALL;
+		}
+		return KIND_STALL;
+	default: return KIND_STRAIGHT; //6XKK, 7XKK, ANNN, CXKK, DXYN
+	}
+}
+
+
+string disassemble(unsigned short opcode) {
+	string vx = registerName((opcode & 0x0F00) >> 8);
+	string vy = registerName((opcode & 0x00F0) >> 4);
+	string kk = hexString(opcode & 0x00FF, 2);
+	string nnn = hexString(opcode & 0x0FFF, 3);
+
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		if (opcode == 0x00E0) return "CLS";
+		if (opcode == 0x00EE) return "RET";
+		if ((opcode & 0xFFF0) == 0x00C0) return "SCD " + to_string(opcode & 0x000F);
+		if (opcode == 0x00FB) return "SCR";
+		if (opcode == 0x00FC) return "SCL";
+		if (opcode == 0x00FD) return "EXIT";
+		if (opcode == 0x00FE) return "LOW";
+		if (opcode == 0x00FF) return "HIGH";
+		return "SYS " + nnn;
+	case 0x1000: return "JP " + nnn;
+	case 0x2000: return "CALL " + nnn;
+	case 0x3000: return "SE " + vx + ", " + kk;
+	case 0x4000: return "SNE " + vx + ", " + kk;
+	case 0x5000: if ((opcode & 0x000F) == 0) return "SE " + vx + ", " + vy; break;
+	case 0x6000: return "LD " + vx + ", " + kk;
+	case 0x7000: return "ADD " + vx + ", " + kk;
+	case 0x8000:
+		switch (opcode & 0x000F) {
+		case 0x0: return "LD " + vx + ", " + vy;
+		case 0x1: return "OR " + vx + ", " + vy;
+		case 0x2: return "AND " + vx + ", " + vy;
+		case 0x3: return "XOR " + vx + ", " + vy;
+		case 0x4: return "ADD " + vx + ", " + vy;
+		case 0x5: return "SUB " + vx + ", " + vy;
+		case 0x6: return "SHR " + vx + ", " + vy;
+		case 0x7: return "SUBN " + vx + ", " + vy;
+		case 0xE: return "SHL " + vx + ", " + vy;
+		}
+		break;
+	case 0x9000: if ((opcode & 0x000F) == 0) return "SNE " + vx + ", " + vy; break;
+	case 0xA000: return "LD I, " + nnn;
+	case 0xB000: return "JP V0, " + nnn;
+	case 0xC000: return "RND " + vx + ", " + kk;
+	case 0xD000: return "DRW " + vx + ", " + vy + ", " + to_string(opcode & 0x000F);
+	case 0xE000:
+		if ((opcode & 0x00FF) == 0x9E) return "SKP " + vx;
+		if ((opcode & 0x00FF) == 0xA1) return "SKNP " + vx;
+		break;
+	case 0xF000:
+		switch (opcode & 0x00FF) {
+		case 0x07: return "LD " + vx + ", DT";
+		case 0x0A: return "LD " + vx + ", K";
+		case 0x15: return "LD DT, " + vx;
+		case 0x18: return "LD ST, " + vx;
+		case 0x1E: return "ADD I, " + vx;
+		case 0x29: return "LD F, " + vx;
+		case 0x30: return "LD HF, " + vx;
+		case 0x33: return "LD B, " + vx;
+		case 0x55: return "LD [I], " + vx;
+		case 0x65: return "LD " + vx + ", [I]";
+		case 0x75: return "LD R, " + vx;
+		case 0x85: return "LD " + vx + ", R";
+		}
+		break;
+	}
+
+	return "DW " + hexString(opcode, 4);
+}
+
+
+unsigned short romAnalysis::opcodeAt(unsigned address) const {
+	return memory[address % 4096] << 8 | memory[(address + 1) % 4096];
+}
+
+
+const basicBlock* romAnalysis::blockAt(unsigned short address) const {
+	for (const basicBlock& block : blocks) {
+		if (block.start == address) {
+			return &block;
+		}
+	}
+	return nullptr;
+}
+
+
+romAnalysis analyzeRom(const vector<unsigned char>& rom) {
+	romAnalysis analysis;
+	analysis.memory.assign(4096, 0);
+	analysis.romSize = (unsigned short)min<size_t>(rom.size(), 4096 - 512);
+	copy(rom.begin(), rom.begin() + analysis.romSize, analysis.memory.begin() + 512);
+	analysis.bytes.assign(4096, BYTE_UNKNOWN);
+	analysis.instructions.assign(4096, false);
+
+	//Recursively follow every path from the entry point
+	vector<unsigned> worklist = { 512 };
+	analysis.leaders.insert(512);
+
+	auto follow = [&](unsigned address) {
+		if (address <= 4094) {
+			analysis.leaders.insert((unsigned short)address);
+			worklist.push_back(address);
+		}
+	};
+
+	while (!worklist.empty()) {
+		unsigned address = worklist.back();
+		worklist.pop_back();
+
+		if (address > 4094 || analysis.instructions[address]) {
+			continue;
+		}
+		analysis.instructions[address] = true;
+		analysis.bytes[address] = BYTE_CODE;
+		analysis.bytes[address + 1] = BYTE_CODE;
+
+		unsigned short opcode = analysis.opcodeAt(address);
+
+		switch (classifyInstruction(opcode)) {
+		case KIND_STRAIGHT: worklist.push_back(address + 2); break;
+		case KIND_STORE:
+		case KIND_WAIT: follow(address + 2); break;
+		case KIND_JUMP: follow(opcode & 0x0FFF); break;
+		case KIND_CALL:
+			analysis.callTargets.insert(opcode & 0x0FFF);
+			follow(opcode & 0x0FFF);
+			follow(address + 2);
+			break;
+		case KIND_SKIP: follow(address + 2); follow(address + 4); break;
+		case KIND_INDIRECT: analysis.indirectJumps.insert((unsigned short)address); break;
+		case KIND_RETURN:
+		case KIND_STALL: break;
+		}
+	}
+
+	//Cut the reachable code in to blocks at every leader and after every control-flow instruction
+	for (unsigned short leader : analysis.leaders) {
+		basicBlock block = { leader, 0, KIND_STRAIGHT, {} };
+		unsigned address = leader;
+
+		while (true) {
+			unsigned short opcode = analysis.opcodeAt(address);
+			instructionKind kind = classifyInstruction(opcode);
+			block.length++;
+
+			if (kind != KIND_STRAIGHT) {
+				block.exit = kind;
+
+				switch (kind) {
+				case KIND_JUMP: block.successors = { (unsigned short)(opcode & 0x0FFF) }; break;
+				case KIND_CALL: block.successors = { (unsigned short)(opcode & 0x0FFF), (unsigned short)(address + 2) }; break;
+				case KIND_SKIP: block.successors = { (unsigned short)(address + 2), (unsigned short)(address + 4) }; break;
+				case KIND_STORE:
+				case KIND_WAIT: block.successors = { (unsigned short)(address + 2) }; break;
+				default: break;
+				}
+
+				for (size_t i = 0; i < block.successors.size();) {
+					if (block.successors[i] > 4094) {
+						block.successors.erase(block.successors.begin() + i);
+					}
+					else {
+						i++;
+					}
+				}
+				break;
+			}
+
+			address += 2;
+			if (address > 4094) {
+				break;
+			}
+			if (analysis.leaders.count((unsigned short)address)) {
+				block.successors = { (unsigned short)address };
+				break;
+			}
+		}
+
+		analysis.blocks.push_back(block);
+	}
+
+	//Loop headers are the targets of back edges found by a depth-first walk of the block graph
+	vector<unsigned char> state(4096, 0); //0 = unvisited, 1 = on the walk's stack, 2 = finished
+
+	for (const basicBlock& root : analysis.blocks) {
+		if (state[root.start] != 0) {
+			continue;
+		}
+
+		vector<pair<const basicBlock*, size_t>> stack = { { &root, 0 } };
+		state[root.start] = 1;
+
+		while (!stack.empty()) {
+			const basicBlock* block = stack.back().first;
+			size_t& next = stack.back().second;
+
+			if (next == block->successors.size()) {
+				state[block->start] = 2;
+				stack.pop_back();
+				continue;
+			}
+
+			unsigned short successor = block->successors[next++];
+			if (state[successor] == 1) {
+				analysis.loopHeaders.insert(successor);
+			}
+			else if (state[successor] == 0) {
+				const basicBlock* successorBlock = analysis.blockAt(successor);
+				if (successorBlock != nullptr) {
+					state[successor] = 1;
+					stack.push_back({ successorBlock, 0 });
+				}
+			}
+		}
+	}
+
+	//Sprites: the bytes DXYN reads after an ANNN in the same block set I (DXY0 reads a 16x16 sprite, 32 bytes)
+	for (const basicBlock& block : analysis.blocks) {
+		int knownI = -1;
+
+		for (unsigned i = 0; i < block.length; i++) {
+			unsigned short opcode = analysis.opcodeAt(block.start + i * 2);
+
+			if ((opcode & 0xF000) == 0xA000) {
+				knownI = opcode & 0x0FFF;
+			}
+			else if ((opcode & 0xF000) == 0xD000 && knownI >= 0) {
+				int size = (opcode & 0x000F) == 0 ? 32 : (opcode & 0x000F);
+				for (int j = 0; j < size && knownI + j < 4096; j++) {
+					if (analysis.bytes[knownI + j] != BYTE_CODE) {
+						analysis.bytes[knownI + j] = BYTE_SPRITE;
+					}
+				}
+			}
+			else if ((opcode & 0xF000) == 0xF000 && ((opcode & 0x00FF) == 0x1E || (opcode & 0x00FF) == 0x29 || (opcode & 0x00FF) == 0x30 ||
+				(opcode & 0x00FF) == 0x55 || (opcode & 0x00FF) == 0x65)) {
+				knownI = -1; //I moved by an amount only known at run time
+			}
+		}
+	}
+
+	return analysis;
+}
+
+
+bool readRomFile(const string& path, vector<unsigned char>& rom) {
+	ifstream inputFile(path, ios::in | ios::binary);
+	if (!inputFile) {
+		return false;
+	}
+
+	rom.assign(istreambuf_iterator<char>(inputFile), istreambuf_iterator<char>());
+	return !rom.empty() && rom.size() <= 4096 - 512;
+}
+
+
+unsigned long long hashRom(const unsigned char* data, size_t size) {
+	unsigned long long hash = 0xCBF29CE484222325ull;
+
+	for (size_t i = 0; i < size; i++) {
+		hash ^= data[i];
+		hash *= 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+
+static const char* kindName(instructionKind kind) {
+	switch (kind) {
+	case KIND_STRAIGHT: return "fallthrough";
+	case KIND_STORE: return "store";
+	case KIND_JUMP: return "jump";
+	case KIND_CALL: return "call";
+	case KIND_RETURN: return "return";
+	case KIND_INDIRECT: return "indirect";
+	case KIND_SKIP: return "skip";
+	case KIND_WAIT: return "wait";
+	case KIND_STALL: return "stall";
+	}
+	return "";
+}
+
+
+void writeListing(ostream& out, const romAnalysis& analysis) {
+	unsigned end = 512 + analysis.romSize;
+
+	for (unsigned address = 512; address < end;) {
+		if (analysis.instructions[address]) {
+			unsigned short opcode = analysis.opcodeAt(address);
+			string mnemonic = disassemble(opcode);
+
+			out << hexString(address, 4) << "  " << hexString(opcode, 4).substr(2) << "  " << mnemonic;
+
+			string notes;
+			if (analysis.callTargets.count(address)) notes += " subroutine";
+			if (analysis.loopHeaders.count(address)) notes += " loop";
+			else if (analysis.leaders.count(address)) notes += " block";
+
+			if (!notes.empty()) {
+				out << string(mnemonic.size() < 20 ? 20 - mnemonic.size() : 1, ' ') << ";" << notes;
+			}
+			out << "\n";
+			address += 2;
+			continue;
+		}
+
+		unsigned char value = analysis.memory[address];
+		out << hexString(address, 4) << "  " << hexString(value, 2).substr(2) << "    DB " << hexString(value, 2);
+
+		//Show sprite rows as pixels
+		if (analysis.bytes[address] == BYTE_SPRITE) {
+			out << "             ; ";
+			for (int bit = 7; bit >= 0; bit--) {
+				out << (((value >> bit) & 1) ? '#' : '.');
+			}
+		}
+		out << "\n";
+		address++;
+	}
+}
+
+
+void writeJson(ostream& out, const romAnalysis& analysis, const string& name) {
+	auto writeSet = [&](const set<unsigned short>& values) {
+		out << "[";
+		for (auto it = values.begin(); it != values.end(); ++it) {
+			out << (it == values.begin() ? "" : ", ") << *it;
+		}
+		out << "]";
+	};
+
+	out << "{\n";
+	out << "  \"rom\": \"" << name << "\",\n";
+	out << "  \"hash\": \"" << hexString(hashRom(&analysis.memory[512], analysis.romSize), 16) << "\",\n";
+	out << "  \"size\": " << analysis.romSize << ",\n";
+	out << "  \"entry\": 512,\n";
+
+	out << "  \"instructions\": [\n";
+	bool first = true;
+	for (unsigned address = 0; address < 4096; address++) {
+		if (analysis.instructions[address]) {
+			out << (first ? "" : ",\n") << "    { \"address\": " << address << ", \"opcode\": \"" << hexString(analysis.opcodeAt(address), 4).substr(2)
+				<< "\", \"mnemonic\": \"" << disassemble(analysis.opcodeAt(address)) << "\" }";
+			first = false;
+		}
+	}
+	out << "\n  ],\n";
+
+	out << "  \"blocks\": [\n";
+	for (size_t i = 0; i < analysis.blocks.size(); i++) {
+		const basicBlock& block = analysis.blocks[i];
+		out << "    { \"start\": " << block.start << ", \"length\": " << block.length << ", \"exit\": \"" << kindName(block.exit) << "\", \"successors\": [";
+		for (size_t j = 0; j < block.successors.size(); j++) {
+			out << (j ? ", " : "") << block.successors[j];
+		}
+		out << "] }" << (i + 1 < analysis.blocks.size() ? "," : "") << "\n";
+	}
+	out << "  ],\n";
+
+	out << "  \"callTargets\": ";
+	writeSet(analysis.callTargets);
+	out << ",\n  \"loopHeaders\": ";
+	writeSet(analysis.loopHeaders);
+	out << ",\n  \"indirectJumps\": ";
+	writeSet(analysis.indirectJumps);
+
+	//Sprite data as [start, end) ranges
+	out << ",\n  \"sprites\": [";
+	first = true;
+	for (unsigned address = 0; address < 4096;) {
+		if (analysis.bytes[address] != BYTE_SPRITE) {
+			address++;
+			continue;
+		}
+		unsigned start = address;
+		while (address < 4096 && analysis.bytes[address] == BYTE_SPRITE) {
+			address++;
+		}
+		out << (first ? "" : ", ") << "[" << start << ", " << address << "]";
+		first = false;
+	}
+	out << "]\n}\n";
+}
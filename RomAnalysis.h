@@ -0,0 +1,79 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <set>
+#include <ostream>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Static analysis of a ROM without running it: disassembly, reachable code, sprite data and the control-flow graph.
+Used by the Disassembler and Recompiler tools, and by anything that wants to know where the code is before execution starts.
+********************************************************************************************************************************/
+
+//How an instruction affects control flow, decoded the same way emulateCycle() decodes it
+enum instructionKind {
+	KIND_STRAIGHT, //Falls through to the next instruction
+	KIND_STORE, //Falls through, but writes memory (FX33/FX55) and may overwrite code
+	KIND_JUMP, //1NNN
+	KIND_CALL, //2NNN
+	KIND_RETURN, //00EE
+	KIND_INDIRECT, //BNNN
+	KIND_SKIP, //3XKK, 4XKK, 5XY0, 9XY0, EX9E, EXA1
+	KIND_WAIT, //FX0A: stays on the same instruction until a key is pressed
+	KIND_STALL //Unknown to the interpreter, which leaves pc where it is
+};
+
+//What the analysis found at each memory address
+enum byteType : unsigned char {
+	BYTE_UNKNOWN = 0, //Never reached or referenced
+	BYTE_CODE = 1, //Part of a reachable instruction
+	BYTE_SPRITE = 2 //Read by DXYN after an ANNN pointed I at it
+};
+
+//A straight run of instructions with a single entry at start and a single exit at its last instruction
+struct basicBlock {
+	unsigned short start;
+	unsigned short length; //Number of instructions
+	instructionKind exit; //Kind of the last instruction (KIND_STRAIGHT when the block falls in to another block)
+	vector<unsigned short> successors; //Blocks control can continue at. Returns and BNNN jumps have none.
+};
+
+struct romAnalysis {
+	vector<unsigned char> memory; //4 KB memory image with the ROM at 0x200
+	unsigned short romSize = 0;
+
+	vector<unsigned char> bytes; //byteType for every address
+	vector<bool> instructions; //true at the address of every reachable instruction
+	set<unsigned short> leaders; //Addresses control arrives at other than by falling through
+	vector<basicBlock> blocks; //Sorted by start address
+	set<unsigned short> callTargets; //2NNN destinations
+	set<unsigned short> loopHeaders; //Blocks entered by a back edge
+	set<unsigned short> indirectJumps; //Addresses of BNNN instructions, whose targets are only known at run time
+
+	unsigned short opcodeAt(unsigned address) const; //The two bytes at address as an opcode
+
+	const basicBlock* blockAt(unsigned short address) const; //The block starting at address, or nullptr
+};
+
+instructionKind classifyInstruction(unsigned short opcode); //Control-flow kind of an opcode
+
+string disassemble(unsigned short opcode); //Mnemonic for an opcode, e.g. "DRW VA, VB, 6"
+
+romAnalysis analyzeRom(const vector<unsigned char>& rom); //Find code, data and blocks of a ROM loaded at 0x200
+
+bool readRomFile(const string& path, vector<unsigned char>& rom); //Read a ROM image. False if missing or too large for 0x200-0xFFF
+
+unsigned long long hashRom(const unsigned char* data, size_t size); //64-bit FNV-1a hash identifying a ROM image
+
+void writeListing(ostream& out, const romAnalysis& analysis); //Human readable disassembly
+
+void writeJson(ostream& out, const romAnalysis& analysis, const string& name); //Machine readable analysis
@@ -0,0 +1,73 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include "RomLibrary.h"
+#include "RomAnalysis.h"
+#include "Quirks.h"
+
+using namespace std;
+
+//Every bundled ROM was written for interpreters matching our default behaviour and plays well at the default speed. The
+//score addresses are where each game puts the BCD digits of its score before drawing them.
+static const romInfo romTable[] = {
+	{ "15PUZZLE", 0xE59FD57FA44ECB40ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "BLINKY", 0x0FD332D0BC68C9F2ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "BRIX", 0xC86E8FF63FCE668Cull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x314 },
+	{ "CONNECT4", 0xADF99268DB3C3BC9ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "GUESS", 0x1BBB10C8E5CADBB5ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "HIDDEN", 0x3F58EB4FA83DCD98ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "INVADERS", 0x8E547EBB12C026B4ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "KALEID", 0xA8E9391EBB18DF6Full, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "MAZE", 0x25E96E1086CE43CBull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "MERLIN", 0x43DEF5533F6D8D25ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x359 },
+	{ "MISSILE", 0x71CDB8B926F1B988ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x2B4 },
+	{ "PONG", 0x624B3EED64313F42ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x2F2 },
+	{ "PONG2", 0x0F81C6A74DCD366Eull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x2F2 },
+	{ "PUZZLE", 0x36F264B8F72349A6ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "TANK", 0x3E2C2D43B296B74Cull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x229 },
+	{ "TETRIS", 0x04EB2109DC29B1ABull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "TICTAC", 0x56049E83866B207Dull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x3E6 },
+	{ "UFO", 0x8D8A02FA3A2ED293ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x2F8 },
+	{ "VERS", 0xEAE1357F230D90C5ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 },
+	{ "WIPEOFF", 0xB7E1D74B387BEDE6ull, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0x2F0 },
+};
+
+
+const romInfo* findRom(unsigned long long hash) {
+	for (const romInfo& entry : romTable) {
+		if (entry.hash == hash) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+
+const romInfo* findRom(const string& name) {
+	size_t slash = name.find_last_of("/\\");
+	string file = slash == string::npos ? name : name.substr(slash + 1);
+
+	for (const romInfo& entry : romTable) {
+		if (file == entry.name) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+
+romInfo romInfoFor(const unsigned char* data, size_t size) {
+	unsigned long long hash = hashRom(data, size);
+
+	const romInfo* known = findRom(hash);
+	if (known != nullptr) {
+		return *known;
+	}
+
+	romInfo unknown = { "", hash, QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP, 0 };
+	return unknown;
+}
@@ -0,0 +1,53 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+ROM library. RomLibrary.cpp has what is known about each ROM: the quirk set it was written for, how fast to run it, its key
+layout and where it keeps its score. Entries are keyed by hashRom() of the ROM image, so a renamed or modified copy is
+recognised (or not) by what it contains.
+
+The bundled ROMs are compiled in to the emulator as byte arrays. BundledRoms.cpp is generated from the ROM files by RomPack
+(RomPack.cpp); run it again after adding or changing a ROM. The menu is built from that index, and picking a ROM does no file
+I/O.
+********************************************************************************************************************************/
+
+const int DEFAULT_CYCLES_PER_FRAME = 10; //540 Hz at 54 frames a second, see runGame()
+const char* const DEFAULT_KEYMAP = "x123qweasdzc4rfv"; //Host key for each Chip8 key 0 - F
+
+struct romInfo {
+	const char* name;
+	unsigned long long hash; //hashRom() of the image
+	unsigned quirks; //Quirk set the ROM was written for
+	int cyclesPerFrame; //Opcodes run every 18.5 ms frame
+	const char* keymap; //Host key for each Chip8 key 0 - F
+	unsigned short scoreAddress; //Where the game stores its score as BCD digits (FX33) to draw it, 0 if not known
+};
+
+struct bundledRom {
+	const char* name;
+	const unsigned char* data;
+	size_t size;
+	unsigned long long hash; //hashRom() of data
+};
+
+//Generated in to BundledRoms.cpp by RomPack
+extern const bundledRom bundledRoms[];
+extern const size_t bundledRomCount;
+
+const romInfo* findRom(unsigned long long hash); //The library entry for a ROM image, or nullptr
+
+const romInfo* findRom(const string& name); //The library entry by name ("roms/PONG" finds PONG), or nullptr
+
+//The entry for an image, or an unnamed one with the defaults (QUIRKS_DEFAULT, DEFAULT_CYCLES_PER_FRAME, DEFAULT_KEYMAP)
+romInfo romInfoFor(const unsigned char* data, size_t size);
@@ -0,0 +1,79 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+ROM packer: compiles ROM files in to the emulator as constexpr byte arrays, with the index the menu is built from (see
+RomLibrary.h).
+
+Usage: RomPack <output.cpp> <rom> [rom...]
+
+Every ROM becomes one array named after its file, and bundledRoms lists them in the order given, with their hashRom().
+The bundled set is generated with: RomPack BundledRoms.cpp 15PUZZLE BLINKY BRIX ... WIPEOFF
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "RomAnalysis.h"
+
+using namespace std;
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		cout << "Usage: RomPack <output.cpp> <rom> [rom...]" << endl;
+		return 1;
+	}
+
+	ostringstream arrays; //One constexpr array a ROM
+	ostringstream index; //bundledRom entries
+	string names;
+
+	for (int i = 2; i < argc; i++) {
+		string romPath = argv[i];
+
+		vector<unsigned char> rom;
+		if (!readRomFile(romPath, rom)) {
+			cout << "Could not read a CHIP-8 ROM from " << romPath << endl;
+			return 1;
+		}
+
+		string name = romPath.substr(romPath.find_last_of("/\\") + 1);
+		string symbol = "rom_";
+		for (char c : name) {
+			symbol += isalnum((unsigned char)c) ? c : '_';
+		}
+		names += (names.empty() ? "" : " ") + name;
+
+		arrays << "static constexpr unsigned char " << symbol << "[] = {";
+		for (size_t b = 0; b < rom.size(); b++) {
+			arrays << (b % 16 == 0 ? "\n\t" : " ") << "0x" << hex << uppercase << setw(2) << setfill('0') << (unsigned)rom[b] << dec
+				<< (b + 1 < rom.size() ? "," : "");
+		}
+		arrays << "\n};\n\n";
+
+		index << "\t{ \"" << name << "\", " << symbol << ", sizeof(" << symbol << "), 0x" << hex << uppercase << setw(16) << setfill('0')
+			<< hashRom(rom.data(), rom.size()) << dec << "ull },\n";
+	}
+
+	ofstream output(argv[1]);
+	if (!output) {
+		cout << "Could not write " << argv[1] << endl;
+		return 1;
+	}
+
+	output << "//Generated by RomPack from " << names << ". Do not edit.\n\n";
+	output << "#include \"RomLibrary.h\"\n\n";
+	output << arrays.str();
+	output << "const bundledRom bundledRoms[] = {\n" << index.str() << "};\n\n";
+	output << "const size_t bundledRomCount = sizeof(bundledRoms) / sizeof(bundledRoms[0]);\n";
+
+	cout << argc - 2 << " ROMs written to " << argv[1] << endl;
+	return 0;
+}
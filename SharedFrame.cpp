@@ -0,0 +1,184 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <cstring>
+#include <thread>
+#include "SharedFrame.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static const unsigned sharedFrameMagic = 0x43384642; //"C8FB"
+
+
+//shm_open() names start with a slash
+static string segmentPath(const string& name) {
+	return (!name.empty() && name[0] == '/') ? name : "/" + name;
+}
+
+
+framePublisher::framePublisher(const string& segmentName) : name(segmentPath(segmentName)) {
+#ifndef _WIN32
+	int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+	if (fd < 0) {
+		return;
+	}
+
+	if (ftruncate(fd, sizeof(sharedFrameSegment)) != 0) {
+		close(fd);
+		shm_unlink(name.c_str());
+		return;
+	}
+
+	void* mapped = mmap(nullptr, sizeof(sharedFrameSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		shm_unlink(name.c_str());
+		return;
+	}
+
+	//Readers check the magic number before anything else, so it is written last
+	segment = (sharedFrameSegment*)mapped;
+	segment->magic = 0;
+	segment->size = sizeof(sharedFrameSegment);
+	segment->sequence.store(0, memory_order_relaxed);
+	memset(&segment->current, 0, sizeof(segment->current));
+	atomic_thread_fence(memory_order_release);
+	segment->magic = sharedFrameMagic;
+#endif
+}
+
+
+framePublisher::~framePublisher() {
+#ifndef _WIN32
+	if (segment != nullptr) {
+		munmap(segment, sizeof(sharedFrameSegment));
+		shm_unlink(name.c_str());
+	}
+#endif
+}
+
+
+bool framePublisher::isOpen() const {
+	return segment != nullptr;
+}
+
+
+void framePublisher::publish(const chip8& machine, unsigned long long cycle) {
+	if (segment == nullptr) {
+		return;
+	}
+
+	unsigned sequence = segment->sequence.load(memory_order_relaxed);
+	segment->sequence.store(sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	publishedFrame& current = segment->current;
+	current.frame = ++frames;
+	current.cycle = cycle;
+	current.hires = machine.displayWidth() == 128;
+	current.xoChip = machine.isXoChip();
+	current.registers = machine.getRegisters();
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		memcpy(current.rows[plane], machine.displayRows(plane), sizeof(current.rows[plane]));
+	}
+
+	segment->sequence.store(sequence + 2, memory_order_release);
+}
+
+
+frameSubscriber::frameSubscriber(const string& segmentName) {
+#ifndef _WIN32
+	int fd = shm_open(segmentPath(segmentName).c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		return;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(sharedFrameSegment)) {
+		close(fd);
+		return;
+	}
+
+	void* mapped = mmap(nullptr, sizeof(sharedFrameSegment), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		return;
+	}
+
+	const sharedFrameSegment* candidate = (const sharedFrameSegment*)mapped;
+	bool valid = candidate->magic == sharedFrameMagic;
+	atomic_thread_fence(memory_order_acquire);
+	if (!valid || candidate->size != sizeof(sharedFrameSegment)) {
+		munmap(mapped, sizeof(sharedFrameSegment));
+		return;
+	}
+
+	segment = candidate;
+#endif
+}
+
+
+frameSubscriber::~frameSubscriber() {
+#ifndef _WIN32
+	if (segment != nullptr) {
+		munmap((void*)segment, sizeof(sharedFrameSegment));
+	}
+#endif
+}
+
+
+bool frameSubscriber::isOpen() const {
+	return segment != nullptr;
+}
+
+
+unsigned long long frameSubscriber::latestFrame() const {
+	if (segment == nullptr) {
+		return 0;
+	}
+
+	while (true) {
+		unsigned before = segment->sequence.load(memory_order_acquire);
+		unsigned long long frame = segment->current.frame;
+		atomic_thread_fence(memory_order_acquire);
+		if ((before & 1) == 0 && segment->sequence.load(memory_order_relaxed) == before) {
+			return frame;
+		}
+		this_thread::yield();
+	}
+}
+
+
+bool frameSubscriber::read(publishedFrame& frame) const {
+	if (segment == nullptr) {
+		return false;
+	}
+
+	for (int attempt = 0; ; attempt++) {
+		unsigned before = segment->sequence.load(memory_order_acquire);
+
+		if ((before & 1) == 0) {
+			memcpy(&frame, (const void*)&segment->current, sizeof(frame));
+			atomic_thread_fence(memory_order_acquire);
+			if (segment->sequence.load(memory_order_relaxed) == before) {
+				return frame.frame != 0;
+			}
+		}
+
+		//The publisher is mid-frame. It only holds the segment for a few hundred nanoseconds, so spin a little first.
+		if (attempt >= 64) {
+			this_thread::yield();
+		}
+	}
+}
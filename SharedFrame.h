@@ -0,0 +1,85 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Shared-memory framebuffer. A framePublisher puts the machine's display planes, registers and frame counter in a POSIX shared
+memory segment (shm_open) once per frame; any number of frameSubscribers in other processes map the same segment and read
+it (see FrameViewer.cpp).
+
+The segment is guarded by a sequence lock: the publisher makes the sequence odd, writes the frame and makes it even again.
+A reader copies the frame and keeps it only if the sequence was the same even number before and after the copy, otherwise
+it tries again. The publisher never waits for a reader and does not know how many there are; publishing costs one 4K copy
+per frame. Segments are named like "/chip8-1"; the publisher removes its segment when it is destroyed.
+********************************************************************************************************************************/
+
+//One published frame
+struct publishedFrame {
+	unsigned long long frame; //Frames published so far, counted from 1
+	unsigned long long cycle; //Cycle stamp the publisher gave the frame
+	unsigned char hires; //1 for the 128 x 64 screen
+	unsigned char xoChip; //1 if the machine is in XO-CHIP mode
+	cpuRegisters registers;
+	displayRow rows[DISPLAY_PLANES][64];
+
+	int width() const { return hires ? 128 : 64; }
+
+	int height() const { return hires ? 64 : 32; }
+};
+
+//Layout of the shared segment
+struct sharedFrameSegment {
+	unsigned magic; //sharedFrameMagic once the segment is initialized
+	unsigned size; //sizeof(sharedFrameSegment), so a viewer built from different sources refuses to read it
+	atomic<unsigned> sequence; //Odd while the publisher is writing
+	publishedFrame current;
+};
+
+//Writes frames in to a new segment
+class framePublisher {
+	string name;
+	sharedFrameSegment* segment = nullptr;
+	unsigned long long frames = 0;
+
+public:
+	explicit framePublisher(const string& segmentName); //Creates (or takes over) the segment
+
+	~framePublisher(); //Unmaps and removes the segment. Attached readers keep the last frame.
+
+	framePublisher(const framePublisher&) = delete;
+	framePublisher& operator=(const framePublisher&) = delete;
+
+	bool isOpen() const; //False if the segment could not be created
+
+	void publish(const chip8& machine, unsigned long long cycle); //Replace the segment's frame with the machine's display and registers
+};
+
+//Reads frames from a segment another process publishes
+class frameSubscriber {
+	const sharedFrameSegment* segment = nullptr;
+
+public:
+	explicit frameSubscriber(const string& segmentName); //Maps the segment read-only
+
+	~frameSubscriber();
+
+	frameSubscriber(const frameSubscriber&) = delete;
+	frameSubscriber& operator=(const frameSubscriber&) = delete;
+
+	bool isOpen() const; //False if there is no such segment or it is not a frame segment
+
+	unsigned long long latestFrame() const; //Frame number currently published, without copying anything (0 = none yet)
+
+	bool read(publishedFrame& frame) const; //Consistent copy of the current frame. False if nothing was published yet.
+};
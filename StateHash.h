@@ -0,0 +1,39 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include "Display.h"
+
+/*******************************************************************************************************************************
+Zobrist-style hashing of machine state. Every memory byte and every display row contributes one 64-bit key, and the hash of
+a memory or a screen is the XOR of the keys of all its bytes or rows. Changing one byte or row then updates the hash in O(1):
+XOR out the key of the old value and XOR in the key of the new one.
+
+The keys are made on the fly by a 64-bit mixer instead of being looked up in a table (a table for 64K bytes x 256 values
+would be 128 MB). Zero bytes and empty rows have the key 0, so cleared memory and a blank screen hash to 0.
+********************************************************************************************************************************/
+
+//SplitMix64 finalizer: every input bit affects every output bit
+inline unsigned long long hashMix(unsigned long long x) {
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+//Key of value at a memory address
+inline unsigned long long memoryKey(unsigned address, unsigned char value) {
+	return value == 0 ? 0 : hashMix(((unsigned long long)address << 8 | value) + 0x9E3779B97F4A7C15ull);
+}
+
+//Key of a display row. index = plane * 64 + line.
+inline unsigned long long rowKey(unsigned index, displayRow row) {
+	if (rowIsEmpty(row)) {
+		return 0;
+	}
+	return hashMix(row.hi ^ (row.lo * 0x9E3779B97F4A7C15ull + ((unsigned long long)(index + 1) << 48)));
+}
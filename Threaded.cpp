@@ -0,0 +1,171 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Threaded interpreter core. It shares decoded[] with the pre-decoded core, but every decodedOp also stores the address of the
+label that executes it. Each handler ends by jumping straight to the next opcode's label ("goto *"), so there is no central
+switch and every handler gets its own, much better predicted, indirect branch.
+
+Labels as values are a GCC/Clang extension. Other compilers run the pre-decoded core when CORE_THREADED is selected.
+********************************************************************************************************************************/
+
+#include "Chip8Ops.h"
+
+using namespace std;
+
+#if defined(__GNUC__)
+
+//Label addresses are stored in the machine on purpose. They stay valid because the labels are in a function, not a frame.
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wdangling-pointer"
+#endif
+
+template <typename Quirks>
+void chip8::runThreaded(int cycles)
+{
+	typedef chip8Ops<Quirks> ops;
+
+	//Handler for every decodedOpId, in enum order
+	static const void* const opLabels[OP_COUNT] = {
+		&&miss, &&cls, &&ret, &&stall, &&jp, &&call, &&seByte, &&sneByte, &&seReg, &&ldByte, &&addByte, &&ldReg,
+		&&orReg, &&andReg, &&xorReg, &&addReg, &&sub, &&shr, &&subn, &&shl, &&sneReg, &&ldI, &&jpV0, &&rnd, &&drw,
+		&&skp, &&sknp, &&ldVxDt, &&ldKey, &&ldDt, &&ldSt, &&addI, &&ldFont, &&bcd, &&store, &&load,
+		&&scd, &&scr, &&scl, &&low, &&high, &&ldBigFont, &&saveFlags, &&loadFlags,
+		&&scu, &&saveRange, &&loadRange, &&ldILong, &&plane, &&audio, &&pitch
+	};
+
+	//Handler for every fusedOpId, in enum order
+	static const void* const fusedLabels[FUSED_COUNT] = {
+		&&miss, &&ldLdDrw, &&ldIDrw, &&addSeJp, &&ldDtSeJp
+	};
+
+	//Handlers left behind by another quirk set or core point at the wrong code, so start over
+	if (threadedMiss != opLabels[OP_UNDECODED]) {
+		threadedMiss = opLabels[OP_UNDECODED];
+		for (unsigned i = 0; i < decoded.size(); i++) {
+			decoded.writable(i).handler = threadedMiss;
+		}
+	}
+
+	unsigned short address;
+	const decodedOp* d;
+
+//Count the opcodes just run and jump straight to the handler of the next one
+#define NEXT(executed) \
+	cycles -= (executed); \
+	if (cycles <= 0) { \
+		return; \
+	} \
+	address = pc & memoryMask; \
+	d = &decoded[address]; \
+	goto *d->handler;
+
+	NEXT(0);
+
+miss:
+	//First visit since the address was decoded or written: decode it and remember which handler runs it
+	if (d->op == OP_UNDECODED) {
+		decode(address);
+	}
+	{
+		decodedOp& w = decoded.writable(address);
+		w.handler = (w.fused != FUSED_NONE) ? fusedLabels[w.fused] : opLabels[w.op];
+		d = &w;
+	}
+	goto *d->handler;
+
+cls: ops::cls(*this, *d); NEXT(1);
+ret: ops::ret(*this, *d); NEXT(1);
+stall: NEXT(1);
+jp: ops::jp(*this, *d); NEXT(1);
+call: ops::call(*this, *d); NEXT(1);
+seByte: ops::seByte(*this, *d); NEXT(1);
+sneByte: ops::sneByte(*this, *d); NEXT(1);
+seReg: ops::seReg(*this, *d); NEXT(1);
+ldByte: ops::ldByte(*this, *d); NEXT(1);
+addByte: ops::addByte(*this, *d); NEXT(1);
+ldReg: ops::ldReg(*this, *d); NEXT(1);
+orReg: ops::orReg(*this, *d); NEXT(1);
+andReg: ops::andReg(*this, *d); NEXT(1);
+xorReg: ops::xorReg(*this, *d); NEXT(1);
+addReg: ops::addReg(*this, *d); NEXT(1);
+sub: ops::sub(*this, *d); NEXT(1);
+shr: ops::shr(*this, *d); NEXT(1);
+subn: ops::subn(*this, *d); NEXT(1);
+shl: ops::shl(*this, *d); NEXT(1);
+sneReg: ops::sneReg(*this, *d); NEXT(1);
+ldI: ops::ldI(*this, *d); NEXT(1);
+jpV0: ops::jpV0(*this, *d); NEXT(1);
+rnd: ops::rnd(*this, *d); NEXT(1);
+drw: ops::drw(*this, *d); NEXT(1);
+skp: ops::skp(*this, *d); NEXT(1);
+sknp: ops::sknp(*this, *d); NEXT(1);
+ldVxDt: ops::ldVxDt(*this, *d); NEXT(1);
+ldKey: ops::ldKey(*this, *d); NEXT(1);
+ldDt: ops::ldDt(*this, *d); NEXT(1);
+ldSt: ops::ldSt(*this, *d); NEXT(1);
+addI: ops::addI(*this, *d); NEXT(1);
+ldFont: ops::ldFont(*this, *d); NEXT(1);
+bcd: ops::bcd(*this, *d); NEXT(1);
+store: ops::store(*this, *d); NEXT(1);
+load: ops::load(*this, *d); NEXT(1);
+scd: ops::scd(*this, *d); NEXT(1);
+scr: ops::scr(*this, *d); NEXT(1);
+scl: ops::scl(*this, *d); NEXT(1);
+low: ops::low(*this, *d); NEXT(1);
+high: ops::high(*this, *d); NEXT(1);
+ldBigFont: ops::ldBigFont(*this, *d); NEXT(1);
+saveFlags: ops::saveFlags(*this, *d); NEXT(1);
+loadFlags: ops::loadFlags(*this, *d); NEXT(1);
+scu: ops::scu(*this, *d); NEXT(1);
+saveRange: ops::saveRange(*this, *d); NEXT(1);
+loadRange: ops::loadRange(*this, *d); NEXT(1);
+ldILong: ops::ldILong(*this, *d); NEXT(1);
+plane: ops::plane(*this, *d); NEXT(1);
+audio: ops::audio(*this, *d); NEXT(1);
+pitch: ops::pitch(*this, *d); NEXT(1);
+
+	//Superinstructions fall back to their first opcode when the whole sequence does not fit in the cycles left
+ldLdDrw:
+	if (cycles < fusedLength[FUSED_LD_LD_DRW]) goto *opLabels[d->op];
+	NEXT(ops::ldLdDrw(*this, *d, decoded[address + 2], decoded[address + 4]));
+ldIDrw:
+	if (cycles < fusedLength[FUSED_LD_I_DRW]) goto *opLabels[d->op];
+	NEXT(ops::ldIDrw(*this, *d, decoded[address + 2]));
+addSeJp:
+	if (cycles < fusedLength[FUSED_ADD_SE_JP]) goto *opLabels[d->op];
+	NEXT(ops::addSeJp(*this, *d, decoded[address + 2], decoded[address + 4]));
+ldDtSeJp:
+	if (cycles < fusedLength[FUSED_LD_DT_SE_JP]) goto *opLabels[d->op];
+	NEXT(ops::ldDtSeJp(*this, *d, decoded[address + 2], decoded[address + 4]));
+
+#undef NEXT
+}
+
+
+template <size_t... Flags>
+const chip8::runFunction* chip8::threadedTable(index_sequence<Flags...>)
+{
+	static const runFunction table[] = { &chip8::runThreaded<quirks<Flags>>... };
+	return table;
+}
+
+
+const chip8::runFunction* chip8::threadedCores()
+{
+	return threadedTable(make_index_sequence<QUIRK_COUNT>());
+}
+
+#else
+
+const chip8::runFunction* chip8::threadedCores()
+{
+	return predecodedCores();
+}
+
+#endif
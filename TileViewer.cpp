@@ -0,0 +1,326 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Tile viewer: runs many machines in one window, laid out in a grid.
+
+Usage: TileViewer <instances> [rom...]
+
+Each instance runs one of the ROMs named (bundled ROM names, or files), taking them in turn, or all the bundled ROMs when
+none are named. Every instance has its own random seed. Click a tile to give it the keyboard; it gets a light border.
+
+All displays live in one RGBA texture atlas, one 130 x 66 cell per tile: the display blown up to 128 x 64, plus a 1 texel
+border. A tile is only expanded again (Expand.h) when its display changed since it was last drawn, and the rows of tiles that
+changed go to the GPU in one glTexSubImage2D() a frame. The whole grid is then one textured quad, so drawing costs the same
+for 1 instance as for 500, and stays cheap on a software GL renderer. On Linux the frames are paced by frameLoop
+(FrameLoop.h), elsewhere by sleeping in the idle callback.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <GL/freeglut.h>
+#include "Chip8.h"
+#include "Expand.h"
+#include "FrameLoop.h"
+#include "RomAnalysis.h"
+#include "RomLibrary.h"
+
+using namespace std;
+
+const int TILE_WIDTH = 130; //Atlas cell: 128 x 64 display and a 1 texel border
+const int TILE_HEIGHT = 66;
+const unsigned BORDER_COLOR = 0xFF303030; //RGBA bytes in memory order, as expandPalette
+const unsigned FOCUS_COLOR = 0xFFC0C0C0;
+const chrono::nanoseconds FRAME_TIME(18518518); //10 cycles at 540Hz, as the emulator
+
+struct tile {
+	chip8 machine;
+	romInfo rom;
+	displayRow shown[DISPLAY_PLANES][64]; //The display as it was last expanded in to the atlas
+	int shownWidth = 0; //0 until it has been drawn
+};
+
+vector<tile> tiles;
+int columns, rows;
+int atlasWidth, atlasHeight; //Pixels of the texture in use
+int textureWidth, textureHeight; //Powers of 2, for GL implementations without non-power-of-2 textures
+vector<unsigned char> atlas;
+GLuint texture;
+expandPalette palette = defaultPalette();
+int focus = 0; //Tile that gets the keyboard
+int dirtyFirst, dirtyLast; //Tile rows to upload this frame, dirtyFirst > dirtyLast for none
+unique_ptr<frameLoop> loop;
+
+bool frame();
+void idle();
+void render();
+void mouse(int button, int state, int x, int y);
+void keyboardDown(unsigned char key, int x, int y);
+void keyboardUp(unsigned char key, int x, int y);
+
+
+static void markDirty(int index) {
+	dirtyFirst = min(dirtyFirst, index / columns);
+	dirtyLast = max(dirtyLast, index / columns);
+}
+
+
+static void drawBorder(int index) {
+	unsigned color = index == focus ? FOCUS_COLOR : BORDER_COLOR;
+	unsigned char* cell = &atlas[((size_t)(index / columns) * TILE_HEIGHT * atlasWidth + (size_t)(index % columns) * TILE_WIDTH) * 4];
+
+	for (int y = 0; y < TILE_HEIGHT; y++) {
+		unsigned char* line = cell + (size_t)y * atlasWidth * 4;
+		for (int x = 0; x < TILE_WIDTH; x++) {
+			if (y == 0 || y == TILE_HEIGHT - 1 || x == 0 || x == TILE_WIDTH - 1) {
+				memcpy(line + x * 4, &color, 4);
+			}
+		}
+	}
+	markDirty(index);
+}
+
+
+//Expand the tile's display in to its cell if it changed since the last time
+static void drawTile(int index) {
+	tile& t = tiles[index];
+	framebufferView view = viewOf(t.machine);
+
+	bool changed = view.width != t.shownWidth;
+	for (int plane = 0; plane < DISPLAY_PLANES && !changed; plane++) {
+		changed = memcmp(t.shown[plane], view.planes[plane], view.height * sizeof(displayRow)) != 0;
+	}
+	if (!changed) {
+		return;
+	}
+
+	for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+		memcpy(t.shown[plane], view.planes[plane], view.height * sizeof(displayRow));
+	}
+	t.shownWidth = view.width;
+
+	size_t inside = ((size_t)(index / columns) * TILE_HEIGHT + 1) * atlasWidth + (size_t)(index % columns) * TILE_WIDTH + 1;
+	expandRgba(view, 128 / view.width, palette, &atlas[inside * 4], (size_t)atlasWidth * 4);
+	markDirty(index);
+}
+
+
+int main(int argc, char** argv) {
+	glutInit(&argc, argv);
+
+	int count = argc > 1 ? atoi(argv[1]) : 0;
+	if (count < 1) {
+		cout << "Usage: TileViewer <instances> [rom...]" << endl;
+		return 1;
+	}
+
+	//The ROM images to deal out: the ones named, or every bundled one
+	vector<vector<unsigned char>> images;
+	for (int i = 2; i < argc; i++) {
+		const romInfo* known = findRom(string(argv[i]));
+		const bundledRom* bundled = nullptr;
+		for (size_t b = 0; b < bundledRomCount && known != nullptr; b++) {
+			if (bundledRoms[b].hash == known->hash) {
+				bundled = &bundledRoms[b];
+			}
+		}
+
+		vector<unsigned char> image;
+		if (bundled != nullptr) {
+			image.assign(bundled->data, bundled->data + bundled->size);
+		}
+		else if (!readRomFile(argv[i], image)) {
+			cout << "Could not read a CHIP-8 ROM from " << argv[i] << endl;
+			return 1;
+		}
+		images.push_back(image);
+	}
+	if (images.empty()) {
+		for (size_t b = 0; b < bundledRomCount; b++) {
+			images.push_back(vector<unsigned char>(bundledRoms[b].data, bundledRoms[b].data + bundledRoms[b].size));
+		}
+	}
+
+	tiles.resize(count);
+	for (int i = 0; i < count; i++) {
+		const vector<unsigned char>& image = images[i % images.size()];
+		tiles[i].rom = romInfoFor(image.data(), image.size());
+		tiles[i].machine.initialize();
+		tiles[i].machine.setQuirks(tiles[i].rom.quirks);
+		tiles[i].machine.setCore(CORE_THREADED);
+		tiles[i].machine.loadProgram(image.data(), image.size());
+		tiles[i].machine.seedRandom(i + 1);
+	}
+
+	glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
+
+	//Twice as many columns as rows suits 2:1 tiles; the texture may not be wider than GL allows, checked once there is a context
+	columns = max(1, (int)ceil(sqrt(count * 2.0)));
+	rows = (count + columns - 1) / columns;
+	float fit = min(1.0f, min(1600.0f / (columns * TILE_WIDTH), 900.0f / (rows * TILE_HEIGHT)));
+	glutInitWindowSize((int)(columns * TILE_WIDTH * fit), (int)(rows * TILE_HEIGHT * fit));
+	glutCreateWindow("CHIP-8 tiles");
+
+	GLint maxTexture = 2048;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTexture);
+	if (columns * TILE_WIDTH > maxTexture) {
+		columns = maxTexture / TILE_WIDTH;
+		rows = (count + columns - 1) / columns;
+	}
+	if (rows * TILE_HEIGHT > maxTexture) {
+		cout << "Too many instances for a " << maxTexture << " x " << maxTexture << " texture" << endl;
+		return 1;
+	}
+
+	atlasWidth = columns * TILE_WIDTH;
+	atlasHeight = rows * TILE_HEIGHT;
+	for (textureWidth = 1; textureWidth < atlasWidth; textureWidth *= 2) {
+	}
+	for (textureHeight = 1; textureHeight < atlasHeight; textureHeight *= 2) {
+	}
+	atlas.assign((size_t)atlasWidth * atlasHeight * 4, 0);
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glEnable(GL_TEXTURE_2D);
+
+	dirtyFirst = rows;
+	dirtyLast = -1;
+	for (int i = 0; i < count; i++) {
+		drawBorder(i);
+	}
+
+	glutDisplayFunc(render);
+	glutMouseFunc(mouse);
+	glutKeyboardFunc(keyboardDown);
+	glutKeyboardUpFunc(keyboardUp);
+
+	loop.reset(new frameLoop(FRAME_TIME));
+	if (loop->isOpen()) {
+		loop->run([](long long) { return frame(); });
+	}
+	loop.reset();
+
+	glutIdleFunc(idle);
+	glutMainLoop();
+
+	return 0;
+}
+
+
+//Run every instance for a frame, then bring the atlas up to date
+bool frame() {
+	for (tile& t : tiles) {
+		t.machine.runCycles(t.rom.cyclesPerFrame);
+		t.machine.decreaseTimers();
+	}
+
+	for (int i = 0; i < (int)tiles.size(); i++) {
+		drawTile(i);
+	}
+
+	if (dirtyFirst <= dirtyLast) {
+		glutPostRedisplay();
+	}
+	return true;
+}
+
+
+void idle() {
+	auto start = chrono::steady_clock::now();
+	frame();
+	this_thread::sleep_for(FRAME_TIME - (chrono::steady_clock::now() - start));
+}
+
+
+void render() {
+	//One upload: the band of tile rows that changed
+	if (dirtyFirst <= dirtyLast) {
+		size_t first = (size_t)dirtyFirst * TILE_HEIGHT;
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, (GLint)first, atlasWidth, (dirtyLast - dirtyFirst + 1) * TILE_HEIGHT, GL_RGBA,
+			GL_UNSIGNED_BYTE, &atlas[first * atlasWidth * 4]);
+		dirtyFirst = rows;
+		dirtyLast = -1;
+	}
+
+	//One draw: the atlas is laid out like the grid, top row first, so it covers the window as a single quad
+	float u = (float)atlasWidth / textureWidth;
+	float v = (float)atlasHeight / textureHeight;
+
+	glClear(GL_COLOR_BUFFER_BIT);
+	glBegin(GL_QUADS);
+	glTexCoord2f(0, 0);
+	glVertex2f(-1, 1);
+	glTexCoord2f(u, 0);
+	glVertex2f(1, 1);
+	glTexCoord2f(u, v);
+	glVertex2f(1, -1);
+	glTexCoord2f(0, v);
+	glVertex2f(-1, -1);
+	glEnd();
+
+	glutSwapBuffers();
+}
+
+
+void mouse(int button, int state, int x, int y) {
+	if (button != GLUT_LEFT_BUTTON || state != GLUT_DOWN) {
+		return;
+	}
+
+	int column = x * columns / max(1, glutGet(GLUT_WINDOW_WIDTH));
+	int row = y * rows / max(1, glutGet(GLUT_WINDOW_HEIGHT));
+	int index = row * columns + column;
+	if (column >= columns || index >= (int)tiles.size() || index == focus) {
+		return;
+	}
+
+	//Keys held on the old tile would otherwise stay down for good
+	for (int k = 0; k < 16; k++) {
+		tiles[focus].machine.key[k] = 0;
+	}
+
+	int previous = focus;
+	focus = index;
+	drawBorder(previous);
+	drawBorder(focus);
+	glutPostRedisplay();
+
+	ostringstream title;
+	title << "CHIP-8 tiles - " << focus + 1 << ": " << (tiles[focus].rom.name[0] != 0 ? tiles[focus].rom.name : "unknown ROM");
+	glutSetWindowTitle(title.str().c_str());
+}
+
+
+void keyboardDown(unsigned char key, int x, int y) {
+	const char* keymap = tiles[focus].rom.keymap;
+	const char* mapped = key != 0 ? strchr(keymap, key) : nullptr;
+	if (mapped != nullptr) {
+		tiles[focus].machine.key[mapped - keymap] = 1;
+	}
+}
+
+
+void keyboardUp(unsigned char key, int x, int y) {
+	const char* keymap = tiles[focus].rom.keymap;
+	const char* mapped = key != 0 ? strchr(keymap, key) : nullptr;
+	if (mapped != nullptr) {
+		tiles[focus].machine.key[mapped - keymap] = 0;
+	}
+}
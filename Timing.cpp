@@ -0,0 +1,159 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include "Timing.h"
+#include "RomAnalysis.h"
+
+using namespace std;
+
+const int UNCAPPED_BATCH = 1024; //Opcodes run between looks at the clock in TIMING_UNCAPPED
+
+//The VIP's 1802 runs a machine cycle every 8 clocks of 1.76064 MHz. The CDP1861 display takes 1024 of the 3668 machine
+//cycles in every 60 Hz field for DMA, which leaves the interpreter the rest.
+const double VIP_MACHINE_CYCLES_PER_SECOND = 1760640.0 / 8;
+const double VIP_INTERPRETER_SHARE = (3668.0 - 1024) / 3668;
+const int VIP_FETCH_CYCLES = 40; //Fetching and decoding an opcode, before it is carried out
+
+
+int vipCost(unsigned short opcode) {
+	int x = (opcode & 0x0F00) >> 8;
+	int n = opcode & 0x000F;
+	int cost = VIP_FETCH_CYCLES;
+
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		return cost + (opcode == 0x00E0 ? 1520 : 10); //00E0 stores to all 256 bytes of display memory in a loop
+	case 0x1000:
+	case 0xA000:
+		return cost + 12;
+	case 0x2000:
+		return cost + 26;
+	case 0x3000:
+	case 0x4000:
+		return cost + 10;
+	case 0x5000:
+	case 0x9000:
+	case 0xE000:
+		return cost + 18;
+	case 0x6000:
+		return cost + 6;
+	case 0x7000:
+		return cost + 10;
+	case 0x8000:
+		return cost + 44;
+	case 0xB000:
+		return cost + 22;
+	case 0xC000:
+		return cost + 36;
+	case 0xD000:
+		//Every sprite row is shifted in to place and XORed over two display bytes. DXY0 draws 16 rows of 2 bytes.
+		return cost + 26 + (n == 0 ? 92 * 16 : 46 * n);
+	default: //0xF000
+		switch (opcode & 0x00FF) {
+		case 0x1E:
+		case 0x29:
+			return cost + 16;
+		case 0x33:
+			return cost + 290; //Repeated subtraction, so it depends on the value; this is for a typical score
+		case 0x55:
+		case 0x65:
+			return cost + 14 + 14 * (x + 1);
+		default: //FX07, FX15, FX18, and each time round FX0A's wait
+			return cost + 10;
+		}
+	}
+}
+
+
+//How many opcodes from pc on the credit pays for, and what they cost. The run follows straight-line code and ends after the
+//first opcode that can continue anywhere but the next one (see classifyInstruction()), so the opcodes counted are the ones
+//that run, and a recompiled block that fits is run whole.
+static int straightRun(const chip8& machine, double credit, double& cost) {
+	unsigned short pc = machine.getRegisters().pc;
+	int count = 0;
+	cost = 0;
+
+	while (cost < credit) {
+		unsigned short opcode = (unsigned short)(machine.readMemory(pc) << 8 | machine.readMemory(pc + 1));
+		cost += vipCost(opcode);
+		count++;
+
+		instructionKind kind = classifyInstruction(opcode);
+		if (kind != KIND_STRAIGHT && kind != KIND_STORE) {
+			break;
+		}
+		pc += 2;
+	}
+
+	return count;
+}
+
+
+bool parseTimingProfile(const string& name, timingProfile& profile) {
+	if (name == "fixed") {
+		profile = TIMING_FIXED;
+	}
+	else if (name == "vip") {
+		profile = TIMING_VIP;
+	}
+	else if (name == "uncapped") {
+		profile = TIMING_UNCAPPED;
+	}
+	else {
+		return false;
+	}
+	return true;
+}
+
+
+frameTiming::frameTiming(chrono::nanoseconds frameLength) : frameTime(frameLength) {
+}
+
+
+void frameTiming::setProfile(timingProfile newProfile) {
+	profile = newProfile;
+	credit = 0;
+}
+
+
+timingProfile frameTiming::getProfile() const {
+	return profile;
+}
+
+
+void frameTiming::setCyclesPerFrame(int cycles) {
+	cyclesPerFrame = cycles;
+}
+
+
+int frameTiming::runFrame(chip8& machine, const function<void(chip8&, int)>& cycle) {
+	if (profile == TIMING_FIXED) {
+		cycle(machine, cyclesPerFrame);
+		return cyclesPerFrame;
+	}
+
+	int ran = 0;
+
+	if (profile == TIMING_VIP) {
+		credit += chrono::duration<double>(frameTime).count() * VIP_MACHINE_CYCLES_PER_SECOND * VIP_INTERPRETER_SHARE;
+		while (credit > 0) {
+			double cost;
+			int count = straightRun(machine, credit, cost);
+			credit -= cost;
+			cycle(machine, count);
+			ran += count;
+		}
+		return ran;
+	}
+
+	auto start = chrono::steady_clock::now();
+	do {
+		cycle(machine, UNCAPPED_BATCH);
+		ran += UNCAPPED_BATCH;
+	} while (chrono::steady_clock::now() - start < frameTime * 3 / 4);
+	return ran;
+}
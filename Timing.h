@@ -0,0 +1,61 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include "Chip8.h"
+#include "RomLibrary.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Frame timing: how many opcodes a frame runs.
+
+TIMING_FIXED runs the same number every frame (the ROM library's cyclesPerFrame), which is what the emulator has always done.
+
+TIMING_VIP charges every opcode the 1802 machine cycles the CHIP-8 interpreter on a COSMAC VIP spent on it, and runs opcodes
+until the cycles the VIP had in the frame's time are spent. A clear screen or a tall sprite costs far more than a register op, so ROMs written
+for the VIP get the pace they were tuned for. What one frame overspends is taken off the next, so the long-run rate is exact.
+The costs are averages (a VIP opcode's time also depends on its operands and on display DMA), and DXYN does not wait for
+the vertical blank as it did on the VIP.
+
+TIMING_UNCAPPED runs opcodes in batches until three quarters of the frame's time has gone by on the host, leaving the rest
+for drawing and input.
+********************************************************************************************************************************/
+
+enum timingProfile {
+	TIMING_FIXED,
+	TIMING_VIP,
+	TIMING_UNCAPPED
+};
+
+int vipCost(unsigned short opcode); //1802 machine cycles the opcode took on a COSMAC VIP, fetch included
+
+bool parseTimingProfile(const string& name, timingProfile& profile); //"fixed", "vip" or "uncapped". False for anything else.
+
+class frameTiming {
+	timingProfile profile = TIMING_FIXED;
+	int cyclesPerFrame = DEFAULT_CYCLES_PER_FRAME;
+	chrono::nanoseconds frameTime;
+	double credit = 0; //VIP machine cycles the last frame left unspent, negative if it overspent
+
+public:
+	explicit frameTiming(chrono::nanoseconds frameLength = chrono::nanoseconds(18518518));
+
+	void setProfile(timingProfile newProfile);
+
+	timingProfile getProfile() const;
+
+	void setCyclesPerFrame(int cycles); //Opcodes a TIMING_FIXED frame runs
+
+	//Run one frame's opcodes through cycle(machine, count), which must run exactly count of them. TIMING_VIP hands them
+	//over a straight run of code at a time. Returns how many were run.
+	int runFrame(chip8& machine, const function<void(chip8&, int)>& cycle);
+};
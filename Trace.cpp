@@ -0,0 +1,193 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "Trace.h"
+
+using namespace std;
+
+static const char traceMagic[8] = { 'C', 'H', 'I', 'P', '8', 'T', 'R', 'C' };
+static const unsigned char traceVersion = 1;
+
+static_assert(sizeof(traceRecord) == 24, "trace files store traceRecords as they are in memory");
+
+
+traceRing::traceRing(size_t capacity, const string& path) {
+	size_t size = 1024;
+	while (size < capacity) {
+		size *= 2;
+	}
+	records.resize(size);
+	mask = size - 1;
+
+	if (path.empty()) {
+		return;
+	}
+
+	file.open(path, ios::out | ios::binary | ios::trunc);
+	if (!file) {
+		openFailed = true;
+		return;
+	}
+
+	file.write(traceMagic, 8);
+	file.put((char)traceVersion);
+	file.put((char)sizeof(traceRecord));
+
+	writer = thread(&traceRing::writeRecords, this);
+}
+
+
+traceRing::~traceRing() {
+	if (writer.joinable()) {
+		stopping.store(true, memory_order_release);
+		writer.join();
+	}
+}
+
+
+bool traceRing::isOpen() const {
+	return !openFailed;
+}
+
+
+void traceRing::writeRecords() {
+	while (true) {
+		//Read stopping first, so every record pushed before it was set is still seen below
+		bool last = stopping.load(memory_order_acquire);
+		unsigned long long from = tail.load(memory_order_relaxed);
+		unsigned long long to = head.load(memory_order_acquire);
+
+		if (from == to) {
+			if (last) {
+				file.flush();
+				return;
+			}
+			this_thread::sleep_for(chrono::milliseconds(1));
+			continue;
+		}
+
+		//Up to the end of the ring, then round again from the start
+		while (from < to) {
+			size_t start = from & mask;
+			size_t count = (size_t)min<unsigned long long>(to - from, records.size() - start);
+			file.write((const char*)&records[start], count * sizeof(traceRecord));
+			from += count;
+		}
+
+		tail.store(to, memory_order_release);
+	}
+}
+
+
+void traceRing::snapshot(vector<traceRecord>& out) const {
+	unsigned long long end = head.load(memory_order_relaxed);
+	unsigned long long count = min<unsigned long long>(end, records.size());
+
+	out.clear();
+	for (unsigned long long i = end - count; i < end; i++) {
+		out.push_back(records[i & mask]);
+	}
+}
+
+
+unsigned long long traceRing::pushed() const {
+	return head.load(memory_order_relaxed);
+}
+
+
+unsigned long long traceRing::stalled() const {
+	return stalls;
+}
+
+
+tracer::tracer(chip8& target, traceRing& output) : machine(target), ring(output) {
+}
+
+
+void tracer::run(int cycles) {
+	for (int i = 0; i < cycles; i++) {
+		traceRecord record;
+		record.cycle = cycle++;
+		record.pc = machine.pc;
+		record.opcode = machine.nextOpcode();
+
+		memoryAccess access = machine.nextAccess();
+		unsigned long long before[2];
+		memcpy(before, machine.V, sizeof(before));
+		unsigned short I = machine.I;
+
+		machine.emulateCycle();
+
+		//Which registers changed: compare 8 at a time, and only look at single ones in a half that differs
+		unsigned long long after[2];
+		memcpy(after, machine.V, sizeof(after));
+		record.changed = machine.I != I ? 1u << TRACE_REGISTER_I : 0;
+		for (int half = 0; half < 2; half++) {
+			unsigned long long difference = before[half] ^ after[half];
+			for (int r = 0; difference != 0; r++, difference >>= 8) {
+				if (difference & 0xFF) {
+					record.changed |= 1u << (half * 8 + r);
+				}
+			}
+		}
+
+		record.value = 0;
+		if (record.changed != 0) {
+			int lowest = 0;
+			while ((record.changed & (1u << lowest)) == 0) {
+				lowest++;
+			}
+			record.value = lowest == TRACE_REGISTER_I ? machine.I : machine.V[lowest];
+		}
+
+		record.writeAddress = (unsigned short)(access.writeFirst & machine.memoryMask);
+		record.writeValue = access.writeCount > 0 ? machine.memory[record.writeAddress] : 0;
+		record.writeCount = (unsigned char)access.writeCount;
+		record.reserved[0] = record.reserved[1] = 0;
+
+		ring.push(record);
+	}
+}
+
+
+unsigned long long tracer::cycles() const {
+	return cycle;
+}
+
+
+traceReader::traceReader(const string& path) {
+	file.open(path, ios::in | ios::binary);
+
+	char magic[8];
+	if (!file.read(magic, 8) || memcmp(magic, traceMagic, 8) != 0 || file.get() != traceVersion ||
+		file.get() != (int)sizeof(traceRecord)) {
+		file.close();
+	}
+}
+
+
+bool traceReader::isOpen() const {
+	return file.is_open();
+}
+
+
+bool traceReader::next(traceRecord& record) {
+	return read(&record, 1) == 1;
+}
+
+
+size_t traceReader::read(traceRecord* out, size_t count) {
+	if (!file.is_open()) {
+		return 0;
+	}
+
+	file.read((char*)out, count * sizeof(traceRecord));
+	return (size_t)file.gcount() / sizeof(traceRecord);
+}
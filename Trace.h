@@ -0,0 +1,122 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Chip8.h"
+
+using namespace std;
+
+/*******************************************************************************************************************************
+Execution trace: one fixed-size record per executed opcode in a ring buffer that belongs to one machine.
+
+The ring has one writer, the thread running the machine, and never takes a lock. On its own it is a flight recorder: it keeps
+the newest records, overwriting the oldest, and snapshot() hands them over after something went wrong. Given a file name it
+also streams every record to that file from a background thread; the machine only waits if the writer falls a whole ring
+behind.
+
+File format: "CHIP8TRC", version (1 byte), record size (1 byte), then the traceRecords exactly as they are in memory
+(little-endian on every platform the emulator builds for).
+
+tracer runs a machine opcode by opcode through emulateCycle() and fills in a record for each one. TraceAnalyzer.cpp reads the
+files back.
+********************************************************************************************************************************/
+
+//No register changed (traceRecord::changed == 0), or the index of I in traceRecord::changed
+const int TRACE_REGISTER_I = 16;
+
+struct traceRecord {
+	unsigned long long cycle; //Opcodes the tracer had run before this one
+	unsigned short pc;
+	unsigned short opcode;
+	unsigned changed; //Bit r: Vr changed, bit TRACE_REGISTER_I: I changed
+	unsigned short value; //New value of the lowest changed register
+	unsigned short writeAddress; //First byte written to memory
+	unsigned char writeValue; //The value written there
+	unsigned char writeCount; //Bytes written from writeAddress on, 0 for none
+	unsigned char reserved[2];
+};
+
+class traceRing {
+	vector<traceRecord> records; //Power of 2 in size
+	size_t mask;
+	atomic<unsigned long long> head{ 0 }; //Records ever pushed
+	atomic<unsigned long long> tail{ 0 }; //Records written to the file
+	unsigned long long stalls = 0; //push() calls that had to wait for the writer
+
+	ofstream file;
+	bool openFailed = false; //A file was asked for and could not be created
+	thread writer;
+	atomic<bool> stopping{ false };
+
+	void writeRecords(); //Writer thread
+
+public:
+	//Ring of at least capacity records. With a path, every record is also written to that file.
+	explicit traceRing(size_t capacity = 1 << 16, const string& path = "");
+
+	~traceRing(); //Writes out the records still in the ring and closes the file
+
+	traceRing(const traceRing&) = delete;
+	traceRing& operator=(const traceRing&) = delete;
+
+	bool isOpen() const; //False if a file was asked for and could not be created
+
+	void push(const traceRecord& record) {
+		unsigned long long position = head.load(memory_order_relaxed);
+
+		if (writer.joinable() && position - tail.load(memory_order_acquire) > mask) {
+			stalls++;
+			while (position - tail.load(memory_order_acquire) > mask) {
+				this_thread::yield();
+			}
+		}
+
+		records[position & mask] = record;
+		head.store(position + 1, memory_order_release);
+	}
+
+	//The newest records still in the ring, oldest first. Call it on the thread that pushes.
+	void snapshot(vector<traceRecord>& out) const;
+
+	unsigned long long pushed() const; //Records ever pushed
+
+	unsigned long long stalled() const; //Times push() waited for the file writer
+};
+
+//Runs a machine with every opcode recorded in a ring
+class tracer {
+	chip8& machine;
+	traceRing& ring;
+	unsigned long long cycle = 0;
+
+public:
+	tracer(chip8& target, traceRing& output);
+
+	void run(int cycles); //Emulate cycles opcodes through emulateCycle(), pushing a record for each
+
+	unsigned long long cycles() const; //Opcodes traced so far
+};
+
+//Reads a trace file back
+class traceReader {
+	ifstream file;
+
+public:
+	explicit traceReader(const string& path);
+
+	bool isOpen() const; //False if the file is missing or not a trace
+
+	bool next(traceRecord& record); //False at the end of the file
+
+	size_t read(traceRecord* out, size_t count); //Up to count records. Returns how many were read.
+};
@@ -0,0 +1,286 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+/*******************************************************************************************************************************
+Trace analyzer: reads execution traces written by traceRing (Trace.h).
+
+Usage: TraceAnalyzer summary <trace> [top]
+       TraceAnalyzer filter <trace> [--pc FIRST[-LAST]] [--opcode MASK:VALUE] [--write FIRST[-LAST]] [--reg Vx|I]
+                                    [--cycles FIRST[-LAST]]
+       TraceAnalyzer diff <trace> <trace> [context]
+
+summary counts the records and memory writes, and lists the most executed addresses and the mix of opcode groups.
+filter prints the records that pass every condition given (all numbers hex, cycles decimal). diff finds the first record
+where two traces part ways and prints it with the context records before it; it exits with 1 if the traces differ.
+********************************************************************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include "Trace.h"
+#include "RomAnalysis.h"
+
+using namespace std;
+
+const size_t READ_CHUNK = 4096; //Records read at a time
+
+struct recordFilter {
+	unsigned pcFirst = 0, pcLast = 0xFFFF;
+	unsigned opcodeMask = 0, opcodeValue = 0;
+	bool writes = false;
+	unsigned writeFirst = 0, writeLast = 0xFFFF;
+	unsigned registers = 0; //traceRecord::changed bits, 0 for any
+	unsigned long long cycleFirst = 0, cycleLast = ~0ull;
+};
+
+
+static void printRecord(const traceRecord& record) {
+	cout << setw(12) << record.cycle << "  " << hex << uppercase << setfill('0') << setw(4) << record.pc << "  " << setw(4)
+		<< record.opcode << "  " << setfill(' ') << left << setw(20) << disassemble(record.opcode) << right << setfill('0');
+
+	for (int r = 0; r <= TRACE_REGISTER_I; r++) {
+		if (record.changed & (1u << r)) {
+			cout << (r == TRACE_REGISTER_I ? string("I") : "V" + string(1, "0123456789ABCDEF"[r]));
+			//Only the lowest changed register's value is recorded
+			if ((record.changed & ((1u << r) - 1)) == 0) {
+				cout << "=" << setw(r == TRACE_REGISTER_I ? 4 : 2) << record.value;
+			}
+			cout << " ";
+		}
+	}
+
+	if (record.writeCount > 0) {
+		cout << "[" << setw(4) << record.writeAddress << "]=" << setw(2) << (int)record.writeValue;
+		if (record.writeCount > 1) {
+			cout << dec << " +" << record.writeCount - 1 << " bytes";
+		}
+	}
+
+	cout << dec << nouppercase << setfill(' ') << endl;
+}
+
+
+static bool sameRecord(const traceRecord& a, const traceRecord& b) {
+	return a.pc == b.pc && a.opcode == b.opcode && a.changed == b.changed && a.value == b.value && a.writeCount == b.writeCount &&
+		(a.writeCount == 0 || (a.writeAddress == b.writeAddress && a.writeValue == b.writeValue));
+}
+
+
+static bool passes(const recordFilter& filter, const traceRecord& record) {
+	if (record.pc < filter.pcFirst || record.pc > filter.pcLast) {
+		return false;
+	}
+	if ((record.opcode & filter.opcodeMask) != filter.opcodeValue) {
+		return false;
+	}
+	if (filter.writes && (record.writeCount == 0 || (unsigned)(record.writeAddress + record.writeCount - 1) < filter.writeFirst ||
+		record.writeAddress > filter.writeLast)) {
+		return false;
+	}
+	if (filter.registers != 0 && (record.changed & filter.registers) == 0) {
+		return false;
+	}
+	return record.cycle >= filter.cycleFirst && record.cycle <= filter.cycleLast;
+}
+
+
+//"FIRST" or "FIRST-LAST" in the given base
+static void parseRange(const string& text, int base, unsigned long long& first, unsigned long long& last) {
+	size_t dash = text.find('-');
+	first = strtoull(text.c_str(), nullptr, base);
+	last = dash == string::npos ? first : strtoull(text.c_str() + dash + 1, nullptr, base);
+}
+
+
+static int summary(traceReader& reader, int top) {
+	vector<traceRecord> chunk(READ_CHUNK);
+	map<unsigned short, unsigned long long> pcCounts;
+	unsigned long long groups[16] = { 0 };
+	unsigned long long records = 0, writes = 0, bytesWritten = 0, firstCycle = 0, lastCycle = 0;
+
+	size_t count;
+	while ((count = reader.read(chunk.data(), chunk.size())) > 0) {
+		for (size_t i = 0; i < count; i++) {
+			const traceRecord& record = chunk[i];
+			if (records++ == 0) {
+				firstCycle = record.cycle;
+			}
+			lastCycle = record.cycle;
+			pcCounts[record.pc]++;
+			groups[record.opcode >> 12]++;
+			if (record.writeCount > 0) {
+				writes++;
+				bytesWritten += record.writeCount;
+			}
+		}
+	}
+
+	cout << records << " records, cycles " << firstCycle << " - " << lastCycle << ", " << pcCounts.size() << " distinct addresses, "
+		<< writes << " memory writes (" << bytesWritten << " bytes)" << endl;
+	if (records == 0) {
+		return 0;
+	}
+
+	vector<pair<unsigned long long, unsigned short>> hottest;
+	for (const auto& entry : pcCounts) {
+		hottest.push_back({ entry.second, entry.first });
+	}
+	sort(hottest.rbegin(), hottest.rend());
+
+	cout << endl << "Most executed:" << endl;
+	for (int i = 0; i < top && i < (int)hottest.size(); i++) {
+		cout << "  " << hex << uppercase << setfill('0') << setw(4) << hottest[i].second << dec << nouppercase << setfill(' ')
+			<< setw(12) << hottest[i].first << setw(7) << fixed << setprecision(2) << 100.0 * hottest[i].first / records << "%" << endl;
+	}
+
+	cout << endl << "Opcode groups:" << endl;
+	for (int group = 0; group < 16; group++) {
+		if (groups[group] > 0) {
+			cout << "  " << hex << uppercase << group << "xxx" << dec << nouppercase << setw(12) << groups[group] << setw(7) << fixed
+				<< setprecision(2) << 100.0 * groups[group] / records << "%" << endl;
+		}
+	}
+
+	return 0;
+}
+
+
+static int filter(traceReader& reader, int argc, char** argv) {
+	recordFilter conditions;
+
+	for (int i = 3; i + 1 < argc; i += 2) {
+		string name = argv[i];
+		string value = argv[i + 1];
+		unsigned long long first, last;
+
+		if (name == "--pc") {
+			parseRange(value, 16, first, last);
+			conditions.pcFirst = (unsigned)first;
+			conditions.pcLast = (unsigned)last;
+		}
+		else if (name == "--opcode" && value.find(':') != string::npos) {
+			conditions.opcodeMask = (unsigned)strtoul(value.c_str(), nullptr, 16);
+			conditions.opcodeValue = (unsigned)strtoul(value.c_str() + value.find(':') + 1, nullptr, 16) & conditions.opcodeMask;
+		}
+		else if (name == "--write") {
+			parseRange(value, 16, first, last);
+			conditions.writes = true;
+			conditions.writeFirst = (unsigned)first;
+			conditions.writeLast = (unsigned)last;
+		}
+		else if (name == "--reg" && (value == "I" || value == "i")) {
+			conditions.registers |= 1u << TRACE_REGISTER_I;
+		}
+		else if (name == "--reg" && value.size() == 2 && (value[0] == 'V' || value[0] == 'v')) {
+			conditions.registers |= 1u << (strtoul(value.c_str() + 1, nullptr, 16) & 15);
+		}
+		else if (name == "--cycles") {
+			parseRange(value, 10, conditions.cycleFirst, conditions.cycleLast);
+		}
+		else {
+			cout << "Unknown filter " << name << " " << value << endl;
+			return 1;
+		}
+	}
+
+	vector<traceRecord> chunk(READ_CHUNK);
+	size_t count;
+	while ((count = reader.read(chunk.data(), chunk.size())) > 0) {
+		for (size_t i = 0; i < count; i++) {
+			if (passes(conditions, chunk[i])) {
+				printRecord(chunk[i]);
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+static int diff(traceReader& first, traceReader& second, size_t context) {
+	deque<traceRecord> before;
+	traceRecord a, b;
+	unsigned long long compared = 0;
+
+	while (true) {
+		bool moreA = first.next(a);
+		bool moreB = second.next(b);
+
+		if (!moreA && !moreB) {
+			cout << "Identical, " << compared << " records" << endl;
+			return 0;
+		}
+
+		if (moreA != moreB || !sameRecord(a, b)) {
+			cout << "Traces differ at record " << compared << endl;
+			for (const traceRecord& record : before) {
+				cout << "  ";
+				printRecord(record);
+			}
+			cout << "< ";
+			if (moreA) {
+				printRecord(a);
+			}
+			else {
+				cout << "(end of trace)" << endl;
+			}
+			cout << "> ";
+			if (moreB) {
+				printRecord(b);
+			}
+			else {
+				cout << "(end of trace)" << endl;
+			}
+			return 1;
+		}
+
+		before.push_back(a);
+		if (before.size() > context) {
+			before.pop_front();
+		}
+		compared++;
+	}
+}
+
+
+int main(int argc, char** argv) {
+	string mode = argc > 2 ? argv[1] : "";
+
+	if (mode != "summary" && mode != "filter" && !(mode == "diff" && argc > 3)) {
+		cout << "Usage: TraceAnalyzer summary <trace> [top]" << endl;
+		cout << "       TraceAnalyzer filter <trace> [--pc FIRST[-LAST]] [--opcode MASK:VALUE] [--write FIRST[-LAST]] [--reg Vx|I]" << endl;
+		cout << "                                    [--cycles FIRST[-LAST]]" << endl;
+		cout << "       TraceAnalyzer diff <trace> <trace> [context]" << endl;
+		return 1;
+	}
+
+	traceReader reader(argv[2]);
+	if (!reader.isOpen()) {
+		cout << "Could not read a trace from " << argv[2] << endl;
+		return 1;
+	}
+
+	if (mode == "summary") {
+		return summary(reader, argc > 3 ? atoi(argv[3]) : 10);
+	}
+	if (mode == "filter") {
+		return filter(reader, argc, argv);
+	}
+
+	traceReader other(argv[3]);
+	if (!other.isOpen()) {
+		cout << "Could not read a trace from " << argv[3] << endl;
+		return 1;
+	}
+	return diff(reader, other, argc > 4 ? (size_t)atoi(argv[4]) : 8);
+}
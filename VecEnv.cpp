@@ -0,0 +1,249 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "VecEnv.h"
+#include "Chip8.h"
+#include "Expand.h"
+#include "RomLibrary.h"
+#include "WorkerPool.h"
+
+using namespace std;
+
+struct rewardProbe {
+	unsigned short address;
+	int length;
+	int encoding;
+	float scale;
+};
+
+//One machine and its episode
+struct envSlot {
+	chip8 machine;
+	unsigned long long seed = 0;
+	unsigned long long frames = 0; //Frames into the episode
+	double score = 0; //Sum of the probes after the last reset or step
+};
+
+struct vecEnv {
+	vector<unsigned char> rom;
+	unsigned quirks = QUIRKS_DEFAULT;
+	int frameSkip = 1;
+	int cyclesPerFrame = DEFAULT_CYCLES_PER_FRAME;
+	unsigned long long episodeFrames = 0;
+	vector<rewardProbe> probes;
+	bool libraryProbe = false; //probes holds only the ROM library's score probe, which the caller's own probes replace
+	vector<envSlot> slots;
+	unique_ptr<workerPool> pool;
+	expandPalette colorIndex; //gray[c] = c, so expandGray() writes colour indices
+};
+
+//Arguments of one vecEnvReset() or vecEnvStep() call. The per-machine loop captures only a reference to them, small enough
+//for std::function to keep without allocating.
+struct envCall {
+	vecEnv* env;
+	const unsigned long long* seeds;
+	const unsigned short* actions;
+	unsigned char* observations;
+	float* rewards;
+	unsigned char* dones;
+};
+
+
+static double probeScore(const vecEnv& env, const chip8& machine) {
+	double score = 0;
+
+	for (const rewardProbe& probe : env.probes) {
+		unsigned long long value = 0;
+		for (int i = 0; i < probe.length; i++) {
+			unsigned char byte = machine.readMemory((unsigned short)(probe.address + i));
+			switch (probe.encoding) {
+			case PROBE_BCD: value = value * 10 + byte; break;
+			case PROBE_BIG_ENDIAN: value = (value << 8) | byte; break;
+			default: value |= (unsigned long long)byte << (8 * i); break;
+			}
+		}
+		score += probe.scale * (double)value;
+	}
+
+	return score;
+}
+
+
+//The program has stopped: it is on 00FD or on a jump to itself
+static bool halted(const chip8& machine) {
+	unsigned short pc = machine.getRegisters().pc;
+	unsigned short opcode = (unsigned short)(machine.readMemory(pc) << 8 | machine.readMemory(pc + 1));
+	return opcode == 0x00FD || opcode == (0x1000 | pc);
+}
+
+
+static void restart(vecEnv& env, envSlot& slot, unsigned long long seed) {
+	slot.machine.initialize();
+	slot.machine.setQuirks(env.quirks);
+	slot.machine.setCore(CORE_THREADED);
+	slot.machine.loadProgram(env.rom.data(), env.rom.size());
+	slot.machine.seedRandom((unsigned)(seed ^ (seed >> 32)));
+	for (int key = 0; key < 16; key++) {
+		slot.machine.key[key] = 0;
+	}
+
+	slot.seed = seed;
+	slot.frames = 0;
+	slot.score = probeScore(env, slot.machine);
+}
+
+
+static void writeObservation(const vecEnv& env, const chip8& machine, unsigned char* out) {
+	framebufferView view = viewOf(machine);
+
+	if (view.width == 64) {
+		expandGray(view, 1, env.colorIndex, out, 64);
+		return;
+	}
+
+	//Hi-res: each observation pixel covers 2 x 2 screen pixels
+	for (int y = 0; y < 32; y++) {
+		for (int x = 0; x < 64; x++) {
+			int color = 0;
+			for (int plane = 0; plane < DISPLAY_PLANES; plane++) {
+				displayRow pair = rowOr(view.planes[plane][y * 2], view.planes[plane][y * 2 + 1]);
+				if (rowPixel(pair, x * 2) || rowPixel(pair, x * 2 + 1)) {
+					color |= 1 << plane;
+				}
+			}
+			out[y * 64 + x] = (unsigned char)color;
+		}
+	}
+}
+
+
+//SplitMix64 step, for the seed of the next episode
+static unsigned long long nextSeed(unsigned long long seed) {
+	unsigned long long z = seed + 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+
+vecEnv* vecEnvCreate(const char* romPath, int count, int frameSkip, int threads) {
+	ifstream file(romPath, ios::in | ios::binary);
+	if (!file || count < 1) {
+		return nullptr;
+	}
+
+	vecEnv* env = new vecEnv();
+	env->rom.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+	string name = romPath;
+	size_t slash = name.find_last_of("/\\");
+	env->quirks = quirksForRom(slash == string::npos ? name : name.substr(slash + 1));
+
+	romInfo info = romInfoFor(env->rom.data(), env->rom.size());
+	env->cyclesPerFrame = info.cyclesPerFrame;
+	if (info.scoreAddress != 0) {
+		env->probes.push_back({ info.scoreAddress, 3, PROBE_BCD, 1.0f }); //The three digits FX33 writes
+		env->libraryProbe = true;
+	}
+
+	env->frameSkip = frameSkip < 1 ? 1 : frameSkip;
+	env->slots.resize(count);
+	env->pool.reset(threads > 0 ? new workerPool(threads) : new workerPool());
+	for (int c = 0; c < 16; c++) {
+		env->colorIndex.gray[c] = (unsigned char)c;
+	}
+
+	for (int i = 0; i < count; i++) {
+		restart(*env, env->slots[i], i);
+	}
+
+	return env;
+}
+
+
+void vecEnvDestroy(vecEnv* env) {
+	delete env;
+}
+
+
+int vecEnvCount(const vecEnv* env) {
+	return (int)env->slots.size();
+}
+
+
+int vecEnvAddRewardProbe(vecEnv* env, unsigned address, int length, int encoding, float scale) {
+	if (length < 1 || length > 8 || encoding < PROBE_BCD || encoding > PROBE_LITTLE_ENDIAN || address > 0xFFFF) {
+		return 0;
+	}
+
+	if (env->libraryProbe) {
+		env->probes.clear();
+		env->libraryProbe = false;
+	}
+	env->probes.push_back({ (unsigned short)address, length, encoding, scale });
+	for (envSlot& slot : env->slots) {
+		slot.score = probeScore(*env, slot.machine);
+	}
+	return 1;
+}
+
+
+void vecEnvSetEpisodeFrames(vecEnv* env, unsigned long long frames) {
+	env->episodeFrames = frames;
+}
+
+
+void vecEnvReset(vecEnv* env, const unsigned long long* seeds, unsigned char* observations) {
+	envCall call = { env, seeds, nullptr, observations, nullptr, nullptr };
+
+	env->pool->forEach(env->slots.size(), [&call](size_t i) {
+		vecEnv& environment = *call.env;
+		restart(environment, environment.slots[i], call.seeds != nullptr ? call.seeds[i] : i);
+		if (call.observations != nullptr) {
+			writeObservation(environment, environment.slots[i].machine, call.observations + i * VEC_ENV_OBSERVATION_SIZE);
+		}
+	});
+}
+
+
+void vecEnvStep(vecEnv* env, const unsigned short* actions, unsigned char* observations, float* rewards, unsigned char* dones) {
+	envCall call = { env, nullptr, actions, observations, rewards, dones };
+
+	env->pool->forEach(env->slots.size(), [&call](size_t i) {
+		vecEnv& environment = *call.env;
+		envSlot& slot = environment.slots[i];
+		chip8& machine = slot.machine;
+
+		for (int key = 0; key < 16; key++) {
+			machine.key[key] = (call.actions[i] >> key) & 1;
+		}
+
+		bool done = false;
+		for (int frame = 0; frame < environment.frameSkip && !done; frame++) {
+			machine.runCycles(environment.cyclesPerFrame);
+			machine.decreaseTimers();
+			slot.frames++;
+			done = halted(machine) || (environment.episodeFrames != 0 && slot.frames >= environment.episodeFrames);
+		}
+
+		double score = probeScore(environment, machine);
+		call.rewards[i] = (float)(score - slot.score);
+		slot.score = score;
+		call.dones[i] = done ? 1 : 0;
+
+		if (done) {
+			restart(environment, slot, nextSeed(slot.seed));
+		}
+
+		writeObservation(environment, machine, call.observations + i * VEC_ENV_OBSERVATION_SIZE);
+	});
+}
@@ -0,0 +1,68 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+/*******************************************************************************************************************************
+Vectorized environment for reinforcement learning: N copies of one ROM stepped together, behind a plain C interface so it can
+be built as a shared library and loaded from Python (ctypes / cffi) or anything else with a C FFI.
+
+	g++ -std=c++17 -O2 -shared -fPIC -DCHIP8_HEADLESS VecEnv.cpp WorkerPool.cpp Expand.cpp Chip8.cpp Quirks.cpp
+		RomLibrary.cpp RomAnalysis.cpp Predecoded.cpp Threaded.cpp -o libchip8env.so -pthread
+
+Observations are written straight in to one caller-owned buffer of count x 32 x 64 bytes, one byte per pixel holding its
+colour index (0 or 1 on a classic machine). The 128 x 64 SUPER-CHIP screen is reduced to 64 x 32 by lighting an observation
+pixel when any of the 2 x 2 pixels it covers is lit. Actions are the keys to hold, bit k = key k.
+
+Rewards come from probes on memory the ROM keeps its score in: a step's reward is the change in the sum of all probes over the
+step. When the ROM library (RomLibrary.h) knows where the ROM keeps its score, there is a probe on the 3 BCD digits there
+until the first vecEnvAddRewardProbe() replaces it. Each frame runs the library's cycles per frame for the ROM.
+
+Episodes end when the program halts (00FD, or a jump to itself) or after the episode frame limit; the machine is then
+restarted at once with a new seed derived from its old one, and the observation returned is the first of the new episode.
+
+Machines are stepped in parallel, one per worker thread at a time. vecEnvReset() and vecEnvStep() allocate nothing: the pool
+runs its batches without allocating, and a restarted machine reuses its own memory pages.
+********************************************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VEC_ENV_OBSERVATION_SIZE (32 * 64)
+
+//How a probe turns memory in to a number
+#define PROBE_BCD 0 //length decimal digits, one per byte, most significant first (what FX33 writes)
+#define PROBE_BIG_ENDIAN 1 //length bytes, an unsigned big-endian integer
+#define PROBE_LITTLE_ENDIAN 2 //length bytes, an unsigned little-endian integer
+
+typedef struct vecEnv vecEnv;
+
+//count machines running romPath, each step running frameSkip frames. threads = 0 uses one thread per core.
+//The quirk set is chosen from the ROM's file name (Quirks.h). Returns NULL if the ROM cannot be read.
+vecEnv* vecEnvCreate(const char* romPath, int count, int frameSkip, int threads);
+
+void vecEnvDestroy(vecEnv* env);
+
+int vecEnvCount(const vecEnv* env);
+
+//Add scale * (value at address) to the score rewards are measured on. The first one replaces the ROM library's score probe.
+//Returns 0 if the probe is invalid.
+int vecEnvAddRewardProbe(vecEnv* env, unsigned address, int length, int encoding, float scale);
+
+//End episodes after frames frames (0 = only when the program halts)
+void vecEnvSetEpisodeFrames(vecEnv* env, unsigned long long frames);
+
+//Restart every machine. seeds (count values, or NULL for 0 .. count - 1) seed CXKK. observations may be NULL.
+void vecEnvReset(vecEnv* env, const unsigned long long* seeds, unsigned char* observations);
+
+//Hold actions[i] on machine i for frameSkip frames. Every output array has count entries (observations count x 32 x 64).
+void vecEnvStep(vecEnv* env, const unsigned short* actions, unsigned char* observations, float* rewards, unsigned char* dones);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,116 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#include <algorithm>
+#include <atomic>
+#include "WorkerPool.h"
+
+using namespace std;
+
+//One forEach() call. Indices are handed out one at a time, so a slow item never holds up the rest.
+struct poolBatch {
+	size_t count;
+	const function<void(size_t)>* body;
+	atomic<size_t> next{ 0 };
+	size_t helpersWanted = 0; //Workers still to join. Guarded by tasksLock, like the rest below.
+	size_t helpersRunning = 0; //Workers that joined and have not finished
+	condition_variable done; //helpersRunning reached 0
+
+	void run() {
+		size_t index;
+		while ((index = next++) < count) {
+			(*body)(index);
+		}
+	}
+};
+
+
+workerPool::workerPool(unsigned threads) {
+	batches.reserve(16);
+	for (unsigned i = 1; i < threads; i++) {
+		workers.emplace_back(&workerPool::work, this);
+	}
+}
+
+
+workerPool::~workerPool() {
+	{
+		lock_guard<mutex> guard(tasksLock);
+		stopping = true;
+	}
+	tasksChanged.notify_all();
+
+	for (thread& worker : workers) {
+		worker.join();
+	}
+}
+
+
+unsigned workerPool::size() const {
+	return (unsigned)workers.size() + 1;
+}
+
+
+void workerPool::work() {
+	unique_lock<mutex> guard(tasksLock);
+
+	while (true) {
+		tasksChanged.wait(guard, [&] { return !batches.empty() || stopping; });
+
+		if (batches.empty()) {
+			return;
+		}
+
+		poolBatch* batch = batches.front();
+		if (--batch->helpersWanted == 0) {
+			batches.erase(batches.begin());
+		}
+		batch->helpersRunning++;
+		guard.unlock();
+
+		batch->run();
+
+		//Notify while holding the lock, so the caller cannot return and free the batch before this is done with it
+		guard.lock();
+		if (--batch->helpersRunning == 0) {
+			batch->done.notify_all();
+		}
+	}
+}
+
+
+void workerPool::forEach(size_t count, const function<void(size_t)>& body) {
+	if (count == 0) {
+		return;
+	}
+
+	poolBatch batch;
+	batch.count = count;
+	batch.body = &body;
+
+	size_t helpers = min(workers.size(), count - 1);
+	if (helpers > 0) {
+		{
+			lock_guard<mutex> guard(tasksLock);
+			batch.helpersWanted = helpers;
+			batches.push_back(&batch);
+		}
+		tasksChanged.notify_all();
+	}
+
+	batch.run();
+
+	//Every index has been taken. Call off the workers that have not joined, and wait for the ones that did.
+	if (helpers > 0) {
+		unique_lock<mutex> guard(tasksLock);
+		if (batch.helpersWanted > 0) {
+			batches.erase(find(batches.begin(), batches.end(), &batch));
+			batch.helpersWanted = 0;
+		}
+		batch.done.wait(guard, [&] { return batch.helpersRunning == 0; });
+	}
+}
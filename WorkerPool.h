@@ -0,0 +1,50 @@
+/*
+Chip-8 Emulator
+Author: Mark Masoumi
+E-mail: masoumi.mark@gmail.com
+Date: April 6 2020
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/*******************************************************************************************************************************
+A fixed set of threads for running independent machines side by side. forEach(count, body) calls body(0) .. body(count - 1)
+spread over the pool and the calling thread, and returns when all of them are done. Several threads may call forEach() at
+once; their batches share the pool.
+
+forEach() does not allocate. The batch lives on the caller's stack, and the pool keeps a pointer to it only until every
+worker that joined it is done; workers that had not joined by the time the caller ran out of indices are called off. body
+itself should capture little enough for std::function to keep it without allocating (a pointer or two).
+********************************************************************************************************************************/
+
+struct poolBatch;
+
+class workerPool {
+	vector<thread> workers;
+	vector<poolBatch*> batches; //Batches that still want workers, oldest first. Only grows, so it stops allocating.
+	mutex tasksLock;
+	condition_variable tasksChanged;
+	bool stopping = false;
+
+	void work(); //Worker thread
+
+public:
+	explicit workerPool(unsigned threads = thread::hardware_concurrency()); //threads counts the caller of forEach(), so threads - 1 are started
+
+	~workerPool();
+
+	workerPool(const workerPool&) = delete;
+	workerPool& operator=(const workerPool&) = delete;
+
+	unsigned size() const; //Threads forEach() runs on, including the caller
+
+	void forEach(size_t count, const function<void(size_t)>& body);
+};